@@ -1,5 +1,8 @@
 #include "HippocacheBlueprintLibrary.h"
 #include "HippocacheSubsystem.h"
+#include "HippocachePropertyValue.h"
+#include "UObject/UnrealType.h"
+#include "UObject/EnumProperty.h"
 #include "Engine/World.h"
 #include "Kismet/KismetSystemLibrary.h"
 #include "Engine/Engine.h"
@@ -12,7 +15,7 @@ FHippocacheResult UHippocacheBlueprintLibrary::GetSubsystemSafe(const UObject* W
 }
 
 // ============================================================================
-// Template helper functions for FVariant-based primitive type handling
+// Template helper functions for native primitive type handling
 // ============================================================================
 // Note: Template implementations are now in the header file for proper linking
 
@@ -88,6 +91,117 @@ FHippocacheResult UHippocacheBlueprintLibrary::GetDouble(const UObject* WorldCon
 	return GetPrimitive<double>(WorldContextObject, Collection, Key, OutValue);
 }
 
+// ============================================================================
+// Atomic numeric operations
+// ============================================================================
+FHippocacheResult UHippocacheBlueprintLibrary::AddInt32(const UObject* WorldContextObject, FName Collection, const FString& Key, int32 Delta, int32& OutNewValue)
+{
+	return NumericImpl<int32>(WorldContextObject, OutNewValue, [&](UHippocacheSubsystem& Subsystem) { return Subsystem.Add<int32>(Collection, Key, Delta); });
+}
+
+FHippocacheResult UHippocacheBlueprintLibrary::IncrementInt32(const UObject* WorldContextObject, FName Collection, const FString& Key, int32& OutNewValue)
+{
+	return NumericImpl<int32>(WorldContextObject, OutNewValue, [&](UHippocacheSubsystem& Subsystem) { return Subsystem.Increment<int32>(Collection, Key); });
+}
+
+FHippocacheResult UHippocacheBlueprintLibrary::DecrementInt32(const UObject* WorldContextObject, FName Collection, const FString& Key, int32& OutNewValue)
+{
+	return NumericImpl<int32>(WorldContextObject, OutNewValue, [&](UHippocacheSubsystem& Subsystem) { return Subsystem.Decrement<int32>(Collection, Key); });
+}
+
+FHippocacheResult UHippocacheBlueprintLibrary::CompareAndSwapInt32(const UObject* WorldContextObject, FName Collection, const FString& Key, int32 Expected, int32 Desired, int32& OutPreviousValue, bool& bOutSwapped)
+{
+	const FHippocacheResult Result = NumericImpl<int32>(WorldContextObject, OutPreviousValue, [&](UHippocacheSubsystem& Subsystem) { return Subsystem.CompareAndSwap<int32>(Collection, Key, Expected, Desired); });
+	bOutSwapped = Result.IsSuccess() && OutPreviousValue == Expected;
+	return Result;
+}
+
+FHippocacheResult UHippocacheBlueprintLibrary::FetchMinInt32(const UObject* WorldContextObject, FName Collection, const FString& Key, int32 Value, int32& OutPreviousValue)
+{
+	return NumericImpl<int32>(WorldContextObject, OutPreviousValue, [&](UHippocacheSubsystem& Subsystem) { return Subsystem.FetchMin<int32>(Collection, Key, Value); });
+}
+
+FHippocacheResult UHippocacheBlueprintLibrary::FetchMaxInt32(const UObject* WorldContextObject, FName Collection, const FString& Key, int32 Value, int32& OutPreviousValue)
+{
+	return NumericImpl<int32>(WorldContextObject, OutPreviousValue, [&](UHippocacheSubsystem& Subsystem) { return Subsystem.FetchMax<int32>(Collection, Key, Value); });
+}
+
+FHippocacheResult UHippocacheBlueprintLibrary::AddInt64(const UObject* WorldContextObject, FName Collection, const FString& Key, int64 Delta, int64& OutNewValue)
+{
+	return NumericImpl<int64>(WorldContextObject, OutNewValue, [&](UHippocacheSubsystem& Subsystem) { return Subsystem.Add<int64>(Collection, Key, Delta); });
+}
+
+FHippocacheResult UHippocacheBlueprintLibrary::IncrementInt64(const UObject* WorldContextObject, FName Collection, const FString& Key, int64& OutNewValue)
+{
+	return NumericImpl<int64>(WorldContextObject, OutNewValue, [&](UHippocacheSubsystem& Subsystem) { return Subsystem.Increment<int64>(Collection, Key); });
+}
+
+FHippocacheResult UHippocacheBlueprintLibrary::DecrementInt64(const UObject* WorldContextObject, FName Collection, const FString& Key, int64& OutNewValue)
+{
+	return NumericImpl<int64>(WorldContextObject, OutNewValue, [&](UHippocacheSubsystem& Subsystem) { return Subsystem.Decrement<int64>(Collection, Key); });
+}
+
+FHippocacheResult UHippocacheBlueprintLibrary::CompareAndSwapInt64(const UObject* WorldContextObject, FName Collection, const FString& Key, int64 Expected, int64 Desired, int64& OutPreviousValue, bool& bOutSwapped)
+{
+	const FHippocacheResult Result = NumericImpl<int64>(WorldContextObject, OutPreviousValue, [&](UHippocacheSubsystem& Subsystem) { return Subsystem.CompareAndSwap<int64>(Collection, Key, Expected, Desired); });
+	bOutSwapped = Result.IsSuccess() && OutPreviousValue == Expected;
+	return Result;
+}
+
+FHippocacheResult UHippocacheBlueprintLibrary::FetchMinInt64(const UObject* WorldContextObject, FName Collection, const FString& Key, int64 Value, int64& OutPreviousValue)
+{
+	return NumericImpl<int64>(WorldContextObject, OutPreviousValue, [&](UHippocacheSubsystem& Subsystem) { return Subsystem.FetchMin<int64>(Collection, Key, Value); });
+}
+
+FHippocacheResult UHippocacheBlueprintLibrary::FetchMaxInt64(const UObject* WorldContextObject, FName Collection, const FString& Key, int64 Value, int64& OutPreviousValue)
+{
+	return NumericImpl<int64>(WorldContextObject, OutPreviousValue, [&](UHippocacheSubsystem& Subsystem) { return Subsystem.FetchMax<int64>(Collection, Key, Value); });
+}
+
+FHippocacheResult UHippocacheBlueprintLibrary::AddFloat(const UObject* WorldContextObject, FName Collection, const FString& Key, float Delta, float& OutNewValue)
+{
+	return NumericImpl<float>(WorldContextObject, OutNewValue, [&](UHippocacheSubsystem& Subsystem) { return Subsystem.Add<float>(Collection, Key, Delta); });
+}
+
+FHippocacheResult UHippocacheBlueprintLibrary::CompareAndSwapFloat(const UObject* WorldContextObject, FName Collection, const FString& Key, float Expected, float Desired, float& OutPreviousValue, bool& bOutSwapped)
+{
+	const FHippocacheResult Result = NumericImpl<float>(WorldContextObject, OutPreviousValue, [&](UHippocacheSubsystem& Subsystem) { return Subsystem.CompareAndSwap<float>(Collection, Key, Expected, Desired); });
+	bOutSwapped = Result.IsSuccess() && OutPreviousValue == Expected;
+	return Result;
+}
+
+FHippocacheResult UHippocacheBlueprintLibrary::FetchMinFloat(const UObject* WorldContextObject, FName Collection, const FString& Key, float Value, float& OutPreviousValue)
+{
+	return NumericImpl<float>(WorldContextObject, OutPreviousValue, [&](UHippocacheSubsystem& Subsystem) { return Subsystem.FetchMin<float>(Collection, Key, Value); });
+}
+
+FHippocacheResult UHippocacheBlueprintLibrary::FetchMaxFloat(const UObject* WorldContextObject, FName Collection, const FString& Key, float Value, float& OutPreviousValue)
+{
+	return NumericImpl<float>(WorldContextObject, OutPreviousValue, [&](UHippocacheSubsystem& Subsystem) { return Subsystem.FetchMax<float>(Collection, Key, Value); });
+}
+
+FHippocacheResult UHippocacheBlueprintLibrary::AddDouble(const UObject* WorldContextObject, FName Collection, const FString& Key, double Delta, double& OutNewValue)
+{
+	return NumericImpl<double>(WorldContextObject, OutNewValue, [&](UHippocacheSubsystem& Subsystem) { return Subsystem.Add<double>(Collection, Key, Delta); });
+}
+
+FHippocacheResult UHippocacheBlueprintLibrary::CompareAndSwapDouble(const UObject* WorldContextObject, FName Collection, const FString& Key, double Expected, double Desired, double& OutPreviousValue, bool& bOutSwapped)
+{
+	const FHippocacheResult Result = NumericImpl<double>(WorldContextObject, OutPreviousValue, [&](UHippocacheSubsystem& Subsystem) { return Subsystem.CompareAndSwap<double>(Collection, Key, Expected, Desired); });
+	bOutSwapped = Result.IsSuccess() && OutPreviousValue == Expected;
+	return Result;
+}
+
+FHippocacheResult UHippocacheBlueprintLibrary::FetchMinDouble(const UObject* WorldContextObject, FName Collection, const FString& Key, double Value, double& OutPreviousValue)
+{
+	return NumericImpl<double>(WorldContextObject, OutPreviousValue, [&](UHippocacheSubsystem& Subsystem) { return Subsystem.FetchMin<double>(Collection, Key, Value); });
+}
+
+FHippocacheResult UHippocacheBlueprintLibrary::FetchMaxDouble(const UObject* WorldContextObject, FName Collection, const FString& Key, double Value, double& OutPreviousValue)
+{
+	return NumericImpl<double>(WorldContextObject, OutPreviousValue, [&](UHippocacheSubsystem& Subsystem) { return Subsystem.FetchMax<double>(Collection, Key, Value); });
+}
+
 // ============================================================================
 // String operations
 // ============================================================================
@@ -391,6 +505,23 @@ FHippocacheResult UHippocacheBlueprintLibrary::Remove(const UObject* WorldContex
 	return Subsystem->Remove(Collection, Key);
 }
 
+FHippocacheResult UHippocacheBlueprintLibrary::Remove(const UObject* WorldContextObject, FName Collection, const FHippocacheKey& Key)
+{
+	UHippocacheSubsystem* Subsystem = nullptr;
+	FHippocacheResult Result = GetSubsystemSafe(WorldContextObject, Subsystem);
+	if (Result.IsError())
+	{
+		return Result;
+	}
+
+	return Subsystem->Remove(Collection, Key);
+}
+
+FHippocacheKey UHippocacheBlueprintLibrary::MakeHippocacheKey(const FString& Key)
+{
+	return FHippocacheKey(Key);
+}
+
 FHippocacheResult UHippocacheBlueprintLibrary::Clear(const UObject* WorldContextObject, FName Collection)
 {
 	UHippocacheSubsystem* Subsystem = nullptr;
@@ -451,12 +582,19 @@ EHippocacheErrorCode UHippocacheBlueprintLibrary::GetErrorCode(const FHippocache
 
 FString UHippocacheBlueprintLibrary::GetErrorMessage(const FHippocacheResult& Result)
 {
-	return Result.ErrorMessage;
+	return Result.GetErrorMessage();
 }
 
 FString UHippocacheBlueprintLibrary::GetErrorContext(const FHippocacheResult& Result)
 {
-	return Result.ErrorContext;
+	return Result.GetErrorContext();
+}
+
+void UHippocacheBlueprintLibrary::BreakHippocacheResult(const FHippocacheResult& Result, EHippocacheErrorCode& ErrorCode, FString& ErrorMessage, FString& ErrorContext)
+{
+	ErrorCode = Result.ErrorCode;
+	ErrorMessage = Result.GetErrorMessage();
+	ErrorContext = Result.GetErrorContext();
 }
 
 FString UHippocacheBlueprintLibrary::DescribeResult(const FHippocacheResult& Result)
@@ -514,14 +652,16 @@ FString UHippocacheBlueprintLibrary::DescribeResult(const FHippocacheResult& Res
 		break;
 	}
 	
-	if (!Result.ErrorMessage.IsEmpty())
+	const FString ErrorMessage = Result.GetErrorMessage();
+	if (!ErrorMessage.IsEmpty())
 	{
-		Description += FString::Printf(TEXT(": %s"), *Result.ErrorMessage);
+		Description += FString::Printf(TEXT(": %s"), *ErrorMessage);
 	}
 	
-	if (!Result.ErrorContext.IsEmpty())
+	const FString ErrorContext = Result.GetErrorContext();
+	if (!ErrorContext.IsEmpty())
 	{
-		Description += FString::Printf(TEXT(" (%s)"), *Result.ErrorContext);
+		Description += FString::Printf(TEXT(" (%s)"), *ErrorContext);
 	}
 	
 	return Description;
@@ -604,8 +744,9 @@ DEFINE_FUNCTION(UHippocacheBlueprintLibrary::execHippooBlueprint)
 		return;
 	}
 	
-	FHippocacheResult Result = ExecuteHippooForProperty(WorldContextObject, Collection, Key, ValueProperty, ValuePtr, 0.0f, false);
-	*(FHippocacheResult*)RESULT_PARAM = Result;
+	FHippocacheResult Result = ExecuteHippooForProperty(WorldContextObject, Collection, FHippocacheKey(MoveTemp(Key)), ValueProperty, ValuePtr, 0.0f, false);
+	Result.Describe();
+	*(FHippocacheResult*)RESULT_PARAM = MoveTemp(Result);
 }
 
 DEFINE_FUNCTION(UHippocacheBlueprintLibrary::execHippooBlueprintWithTTL)
@@ -636,8 +777,9 @@ DEFINE_FUNCTION(UHippocacheBlueprintLibrary::execHippooBlueprintWithTTL)
 		return;
 	}
 	
-	FHippocacheResult Result = ExecuteHippooForProperty(WorldContextObject, Collection, Key, ValueProperty, ValuePtr, TTLSeconds, true);
-	*(FHippocacheResult*)RESULT_PARAM = Result;
+	FHippocacheResult Result = ExecuteHippooForProperty(WorldContextObject, Collection, FHippocacheKey(MoveTemp(Key)), ValueProperty, ValuePtr, TTLSeconds, true);
+	Result.Describe();
+	*(FHippocacheResult*)RESULT_PARAM = MoveTemp(Result);
 }
 
 DEFINE_FUNCTION(UHippocacheBlueprintLibrary::execHippopBlueprint)
@@ -667,165 +809,205 @@ DEFINE_FUNCTION(UHippocacheBlueprintLibrary::execHippopBlueprint)
 		return;
 	}
 	
-	FHippocacheResult Result = ExecuteHippopForProperty(WorldContextObject, Collection, Key, ValueProperty, ValuePtr);
-	*(FHippocacheResult*)RESULT_PARAM = Result;
+	FHippocacheResult Result = ExecuteHippopForProperty(WorldContextObject, Collection, FHippocacheKey(MoveTemp(Key)), ValueProperty, ValuePtr);
+	Result.Describe();
+	*(FHippocacheResult*)RESULT_PARAM = MoveTemp(Result);
 }
 
-// Template helper function to execute Hippoo with type dispatch
-template<typename T>
-FHippocacheResult ExecuteHippooWithType(const UObject* WorldContextObject, FName Collection, const FString& Key, const T& Value, float TTLSeconds, bool bUseTTL)
+DEFINE_FUNCTION(UHippocacheBlueprintLibrary::execHippooByKey)
 {
-	return bUseTTL ? UHippocacheBlueprintLibrary::Hippoo(WorldContextObject, Collection, Key, Value, TTLSeconds) 
-	               : UHippocacheBlueprintLibrary::Hippoo(WorldContextObject, Collection, Key, Value);
-}
-
-// Helper function to convert FProperty values to FVariant
-bool UHippocacheBlueprintLibrary::PropertyToVariant(FProperty* Property, void* ValuePtr, FVariant& OutVariant)
-{
-	if (!Property || !ValuePtr)
-	{
-		return false;
-	}
-
-	if (FBoolProperty* BoolProp = CastField<FBoolProperty>(Property))
-	{
-		bool Value = BoolProp->GetPropertyValue(ValuePtr);
-		OutVariant = FVariant(Value);
-		return true;
-	}
-	else if (FByteProperty* ByteProp = CastField<FByteProperty>(Property))
-	{
-		uint8 Value = ByteProp->GetPropertyValue(ValuePtr);
-		OutVariant = FVariant(Value);
-		return true;
-	}
-	else if (FIntProperty* IntProp = CastField<FIntProperty>(Property))
-	{
-		int32 Value = IntProp->GetPropertyValue(ValuePtr);
-		OutVariant = FVariant(Value);
-		return true;
-	}
-	else if (FInt64Property* Int64Prop = CastField<FInt64Property>(Property))
-	{
-		int64 Value = Int64Prop->GetPropertyValue(ValuePtr);
-		OutVariant = FVariant(Value);
-		return true;
-	}
-	else if (FFloatProperty* FloatProp = CastField<FFloatProperty>(Property))
-	{
-		float Value = FloatProp->GetPropertyValue(ValuePtr);
-		OutVariant = FVariant(Value);
-		return true;
-	}
-	else if (FDoubleProperty* DoubleProp = CastField<FDoubleProperty>(Property))
-	{
-		double Value = DoubleProp->GetPropertyValue(ValuePtr);
-		OutVariant = FVariant(Value);
-		return true;
-	}
-	else if (FStrProperty* StrProp = CastField<FStrProperty>(Property))
+	// Get parameters from Blueprint stack
+	P_GET_OBJECT_REF(UObject, WorldContextObject);
+	P_GET_PROPERTY(FNameProperty, Collection);
+	P_GET_STRUCT_REF(FHippocacheKey, Key);
+	
+	// Get the Value parameter - this is the wildcard parameter
+	FProperty* ValueProperty = nullptr;
+	Stack.Step(Context, ValueProperty);
+	void* ValuePtr = Stack.MostRecentPropertyAddress;
+	
+	// If ValueProperty is null, get it from MostRecentProperty
+	if (!ValueProperty)
 	{
-		FString Value = StrProp->GetPropertyValue(ValuePtr);
-		OutVariant = FVariant(Value);
-		return true;
+		ValueProperty = Stack.MostRecentProperty;
 	}
-	else if (FNameProperty* NameProp = CastField<FNameProperty>(Property))
+	
+	P_FINISH;
+	
+	if (!ValueProperty || !ValuePtr)
 	{
-		FName Value = NameProp->GetPropertyValue(ValuePtr);
-		OutVariant = FVariant(Value);
-		return true;
+		*(FHippocacheResult*)RESULT_PARAM = FHippocacheResult::Error(EHippocacheErrorCode::InvalidValue, 
+			TEXT("Failed to get value parameter"), TEXT("CustomThunk HippooByKey"));
+		return;
 	}
-
-	// Unsupported property type for FVariant conversion
-	return false;
+	
+	FHippocacheResult Result = ExecuteHippooForProperty(WorldContextObject, Collection, Key, ValueProperty, ValuePtr, 0.0f, false);
+	Result.Describe();
+	*(FHippocacheResult*)RESULT_PARAM = MoveTemp(Result);
 }
 
-// Helper function to extract FVariant values back to FProperty
-bool UHippocacheBlueprintLibrary::VariantToProperty(const FVariant& Variant, FProperty* Property, void* ValuePtr)
+DEFINE_FUNCTION(UHippocacheBlueprintLibrary::execHippooByKeyWithTTL)
 {
-	if (!Property || !ValuePtr)
-	{
-		return false;
-	}
-
-	if (FBoolProperty* BoolProp = CastField<FBoolProperty>(Property))
-	{
-		bool Value = Variant.GetValue<bool>();
-		BoolProp->SetPropertyValue(ValuePtr, Value);
-		return true;
-	}
-	else if (FByteProperty* ByteProp = CastField<FByteProperty>(Property))
+	// Get parameters from Blueprint stack
+	P_GET_OBJECT_REF(UObject, WorldContextObject);
+	P_GET_PROPERTY(FNameProperty, Collection);
+	P_GET_STRUCT_REF(FHippocacheKey, Key);
+	
+	// Get the Value parameter - this is the wildcard parameter
+	FProperty* ValueProperty = nullptr;
+	Stack.Step(Context, ValueProperty);
+	void* ValuePtr = Stack.MostRecentPropertyAddress;
+	
+	// If ValueProperty is null, get it from MostRecentProperty
+	if (!ValueProperty)
 	{
-		uint8 Value = Variant.GetValue<uint8>();
-		ByteProp->SetPropertyValue(ValuePtr, Value);
-		return true;
+		ValueProperty = Stack.MostRecentProperty;
 	}
-	else if (FIntProperty* IntProp = CastField<FIntProperty>(Property))
+	
+	P_GET_PROPERTY(FFloatProperty, TTLSeconds);
+	P_FINISH;
+	
+	if (!ValueProperty || !ValuePtr)
 	{
-		int32 Value = Variant.GetValue<int32>();
-		IntProp->SetPropertyValue(ValuePtr, Value);
-		return true;
+		*(FHippocacheResult*)RESULT_PARAM = FHippocacheResult::Error(EHippocacheErrorCode::InvalidValue, 
+			TEXT("Failed to get value parameter"), TEXT("CustomThunk HippooByKeyWithTTL"));
+		return;
 	}
-	else if (FInt64Property* Int64Prop = CastField<FInt64Property>(Property))
+	
+	FHippocacheResult Result = ExecuteHippooForProperty(WorldContextObject, Collection, Key, ValueProperty, ValuePtr, TTLSeconds, true);
+	Result.Describe();
+	*(FHippocacheResult*)RESULT_PARAM = MoveTemp(Result);
+}
+
+DEFINE_FUNCTION(UHippocacheBlueprintLibrary::execHippopByKey)
+{
+	// Get parameters from Blueprint stack
+	P_GET_OBJECT_REF(UObject, WorldContextObject);
+	P_GET_PROPERTY(FNameProperty, Collection);
+	P_GET_STRUCT_REF(FHippocacheKey, Key);
+	
+	// Get the OutValue parameter - this is the wildcard parameter
+	FProperty* ValueProperty = nullptr;
+	Stack.Step(Context, ValueProperty);
+	void* ValuePtr = Stack.MostRecentPropertyAddress;
+	
+	// If ValueProperty is null, get it from MostRecentProperty
+	if (!ValueProperty)
 	{
-		int64 Value = Variant.GetValue<int64>();
-		Int64Prop->SetPropertyValue(ValuePtr, Value);
-		return true;
+		ValueProperty = Stack.MostRecentProperty;
 	}
-	else if (FFloatProperty* FloatProp = CastField<FFloatProperty>(Property))
+	
+	P_FINISH;
+	
+	if (!ValueProperty || !ValuePtr)
 	{
-		float Value = Variant.GetValue<float>();
-		FloatProp->SetPropertyValue(ValuePtr, Value);
-		return true;
+		*(FHippocacheResult*)RESULT_PARAM = FHippocacheResult::Error(EHippocacheErrorCode::InvalidValue, 
+			TEXT("Failed to get value parameter"), TEXT("CustomThunk HippopByKey"));
+		return;
 	}
-	else if (FDoubleProperty* DoubleProp = CastField<FDoubleProperty>(Property))
+	
+	FHippocacheResult Result = ExecuteHippopForProperty(WorldContextObject, Collection, Key, ValueProperty, ValuePtr);
+	Result.Describe();
+	*(FHippocacheResult*)RESULT_PARAM = MoveTemp(Result);
+}
+
+namespace HippocacheBlueprintLibraryPrivate
+{
+	// Property kinds the universal nodes can cache
+	enum class EPropertyKind : uint8
 	{
-		double Value = Variant.GetValue<double>();
-		DoubleProp->SetPropertyValue(ValuePtr, Value);
-		return true;
-	}
-	else if (FStrProperty* StrProp = CastField<FStrProperty>(Property))
+		Unsupported,
+		Struct,
+		Bool,
+		Byte,
+		Int,
+		Int64,
+		Float,
+		Double,
+		String,
+		Name,
+		// Properties without a struct of their own, cached as FHippocachePropertyValue
+		Generic
+	};
+
+	// Subclasses of the supported properties, such as FLargeWorldCoordinatesRealProperty, resolve to their
+	// base's kind. Most derived bases are checked first, so a subclass is never mistaken for an unrelated base.
+	EPropertyKind ResolveDerivedPropertyKind(const FProperty* Property)
 	{
-		FString Value = Variant.GetValue<FString>();
-		StrProp->SetPropertyValue(ValuePtr, Value);
-		return true;
+		if (Property->IsA<FStructProperty>()) { return EPropertyKind::Struct; }
+		if (Property->IsA<FBoolProperty>())   { return EPropertyKind::Bool; }
+		if (Property->IsA<FByteProperty>())   { return EPropertyKind::Byte; }
+		if (Property->IsA<FIntProperty>())    { return EPropertyKind::Int; }
+		if (Property->IsA<FInt64Property>())  { return EPropertyKind::Int64; }
+		if (Property->IsA<FFloatProperty>())  { return EPropertyKind::Float; }
+		if (Property->IsA<FDoubleProperty>()) { return EPropertyKind::Double; }
+		if (Property->IsA<FStrProperty>())    { return EPropertyKind::String; }
+		if (Property->IsA<FNameProperty>())   { return EPropertyKind::Name; }
+		if (Property->IsA<FArrayProperty>() || Property->IsA<FMapProperty>() || Property->IsA<FSetProperty>()
+			|| Property->IsA<FEnumProperty>() || Property->IsA<FSoftObjectProperty>())
+		{
+			return EPropertyKind::Generic;
+		}
+		return EPropertyKind::Unsupported;
 	}
-	else if (FNameProperty* NameProp = CastField<FNameProperty>(Property))
+
+	/**
+	 * Every FFieldClass is identified by its own CASTCLASS_ flag, so the common case is one switch on that id
+	 * rather than a CastField per candidate type. Classes without a case of their own fall back to IsA checks.
+	 */
+	EPropertyKind ResolvePropertyKind(const FProperty* Property)
 	{
-		FName Value = Variant.GetValue<FName>();
-		NameProp->SetPropertyValue(ValuePtr, Value);
-		return true;
+		switch (Property->GetClass()->GetId())
+		{
+		case CASTCLASS_FStructProperty: return EPropertyKind::Struct;
+		case CASTCLASS_FBoolProperty:   return EPropertyKind::Bool;
+		case CASTCLASS_FByteProperty:   return EPropertyKind::Byte;
+		case CASTCLASS_FIntProperty:    return EPropertyKind::Int;
+		case CASTCLASS_FInt64Property:  return EPropertyKind::Int64;
+		case CASTCLASS_FFloatProperty:  return EPropertyKind::Float;
+		case CASTCLASS_FDoubleProperty: return EPropertyKind::Double;
+		case CASTCLASS_FStrProperty:    return EPropertyKind::String;
+		case CASTCLASS_FNameProperty:   return EPropertyKind::Name;
+		case CASTCLASS_FArrayProperty:
+		case CASTCLASS_FMapProperty:
+		case CASTCLASS_FSetProperty:
+		case CASTCLASS_FEnumProperty:
+		case CASTCLASS_FSoftObjectProperty:
+		case CASTCLASS_FSoftClassProperty:
+		                                return EPropertyKind::Generic;
+		default:                        return ResolveDerivedPropertyKind(Property);
+		}
 	}
+}
 
-	// Unsupported property type or type mismatch
-	return false;
+// Template helper function to execute Hippoo with type dispatch
+template<typename T>
+FHippocacheResult ExecuteHippooWithType(const UObject* WorldContextObject, FName Collection, const FHippocacheKey& Key, const T& Value, float TTLSeconds, bool bUseTTL)
+{
+	return bUseTTL ? UHippocacheBlueprintLibrary::Hippoo(WorldContextObject, Collection, Key, Value, TTLSeconds) 
+	               : UHippocacheBlueprintLibrary::Hippoo(WorldContextObject, Collection, Key, Value);
 }
 
 // Helper function to execute Hippoo based on property type using template dispatch
-FHippocacheResult UHippocacheBlueprintLibrary::ExecuteHippooForProperty(const UObject* WorldContextObject, FName Collection, const FString& Key, FProperty* ValueProperty, void* ValuePtr, float TTLSeconds, bool bUseTTL)
+FHippocacheResult UHippocacheBlueprintLibrary::ExecuteHippooForProperty(const UObject* WorldContextObject, FName Collection, const FHippocacheKey& Key, FProperty* ValueProperty, void* ValuePtr, float TTLSeconds, bool bUseTTL)
 {
+	using namespace HippocacheBlueprintLibraryPrivate;
+
 	if (!ValueProperty || !ValuePtr)
 	{
 		return FHippocacheResult::Error(EHippocacheErrorCode::InvalidValue, TEXT("Invalid property or value pointer"), TEXT("ExecuteHippooForProperty"));
 	}
 	
-	// Check if it's a struct property - handle with FInstancedStruct
-	if (FStructProperty* StructProp = CastField<FStructProperty>(ValueProperty))
+	switch (ResolvePropertyKind(ValueProperty))
 	{
-		UScriptStruct* StructType = StructProp->Struct;
+	case EPropertyKind::Struct:
+	{
+		UScriptStruct* StructType = static_cast<FStructProperty*>(ValueProperty)->Struct;
 		if (!StructType)
 		{
 			return FHippocacheResult::Error(EHippocacheErrorCode::UnsupportedType, TEXT("Invalid struct type"), TEXT("ExecuteHippooForProperty"));
 		}
 		
-		// Convert all structs to FInstancedStruct and let the template Hippoo handle it
-		FInstancedStruct InstancedStruct;
-		InstancedStruct.InitializeAs(StructType, static_cast<uint8*>(ValuePtr));
-		return ExecuteHippooWithType(WorldContextObject, Collection, Key, InstancedStruct, TTLSeconds, bUseTTL);
-	}
-	else
-	{
-		// All non-struct types: use FVariant wrapper via SetPrimitive template
 		UHippocacheSubsystem* Subsystem = nullptr;
 		FHippocacheResult Result = GetSubsystemSafe(WorldContextObject, Subsystem);
 		if (Result.IsError())
@@ -833,67 +1015,117 @@ FHippocacheResult UHippocacheBlueprintLibrary::ExecuteHippooForProperty(const UO
 			return Result;
 		}
 
-		// Create FVariant from the property value and wrap it
-		FVariant Variant;
-		if (!PropertyToVariant(ValueProperty, ValuePtr, Variant))
+		// The cached value is built straight from the Blueprint's property memory
+		return Subsystem->SetStructWithTTL(Collection, Key, StructType, ValuePtr, bUseTTL ? FTimespan::FromSeconds(TTLSeconds) : FTimespan::Zero());
+	}
+	case EPropertyKind::Bool:
+		// Bitfield bools can't be read through a bool pointer
+		return ExecuteHippooWithType(WorldContextObject, Collection, Key, static_cast<FBoolProperty*>(ValueProperty)->GetPropertyValue(ValuePtr), TTLSeconds, bUseTTL);
+	case EPropertyKind::Byte:
+		return ExecuteHippooWithType(WorldContextObject, Collection, Key, *static_cast<uint8*>(ValuePtr), TTLSeconds, bUseTTL);
+	case EPropertyKind::Int:
+		// Numbers take the native path of the typed setters, so the atomic operations work on them
+		return ExecuteHippooWithType(WorldContextObject, Collection, Key, *static_cast<int32*>(ValuePtr), TTLSeconds, bUseTTL);
+	case EPropertyKind::Int64:
+		return ExecuteHippooWithType(WorldContextObject, Collection, Key, *static_cast<int64*>(ValuePtr), TTLSeconds, bUseTTL);
+	case EPropertyKind::Float:
+		return ExecuteHippooWithType(WorldContextObject, Collection, Key, *static_cast<float*>(ValuePtr), TTLSeconds, bUseTTL);
+	case EPropertyKind::Double:
+		return ExecuteHippooWithType(WorldContextObject, Collection, Key, *static_cast<double*>(ValuePtr), TTLSeconds, bUseTTL);
+	case EPropertyKind::String:
+		return ExecuteHippooWithType(WorldContextObject, Collection, Key, *static_cast<FString*>(ValuePtr), TTLSeconds, bUseTTL);
+	case EPropertyKind::Name:
+		return ExecuteHippooWithType(WorldContextObject, Collection, Key, *static_cast<FName*>(ValuePtr), TTLSeconds, bUseTTL);
+	case EPropertyKind::Generic:
+	{
+		// The cache doesn't report references to the GC, so values holding objects would dangle
+		TArray<const FStructProperty*> EncounteredStructProps;
+		if (ValueProperty->ContainsObjectReference(EncounteredStructProps))
 		{
 			return FHippocacheResult::Error(EHippocacheErrorCode::UnsupportedType, 
-				FString::Printf(TEXT("Cannot convert property type to FVariant: %s"), *ValueProperty->GetClass()->GetName()), 
-				TEXT("ExecuteHippooForProperty"));
+				TEXT("Values holding object references are not supported for cache storage"), 
+				FString::Printf(TEXT("Collection: %s, Key: %s, Type: %s"), *Collection.ToString(), *Key.GetKey(), *ValueProperty->GetCPPType()));
 		}
 
-		// Wrap in FVariantWrapper and store as FInstancedStruct
-		FVariantWrapper Wrapper(Variant);
-		FInstancedStruct InstancedStruct = FInstancedStruct::Make<FVariantWrapper>(Wrapper);
-		
-		return bUseTTL ? Subsystem->SetStructWithTTL(Collection, Key, InstancedStruct, FTimespan::FromSeconds(TTLSeconds))
-		               : Subsystem->SetStruct(Collection, Key, InstancedStruct);
+		UHippocacheSubsystem* Subsystem = nullptr;
+		FHippocacheResult Result = GetSubsystemSafe(WorldContextObject, Subsystem);
+		if (Result.IsError())
+		{
+			return Result;
+		}
+
+		return Subsystem->SetStructWithTTL(Collection, Key, FHippocachePropertyValue(ValueProperty, ValuePtr), bUseTTL ? FTimespan::FromSeconds(TTLSeconds) : FTimespan::Zero());
+	}
+	default:
+		return FHippocacheResult::Error(EHippocacheErrorCode::UnsupportedType, 
+			FString::Printf(TEXT("Unsupported property type: %s"), *ValueProperty->GetClass()->GetName()), 
+			TEXT("ExecuteHippooForProperty"));
 	}
 }
 
 // Template helper function to execute Hippop with type dispatch
 template<typename T>
-FHippocacheResult ExecuteHippopWithType(const UObject* WorldContextObject, FName Collection, const FString& Key, T& OutValue)
+FHippocacheResult ExecuteHippopWithType(const UObject* WorldContextObject, FName Collection, const FHippocacheKey& Key, T& OutValue)
 {
 	return UHippocacheBlueprintLibrary::Hippop(WorldContextObject, Collection, Key, OutValue);
 }
 
 // Helper function to execute Hippop based on property type using template dispatch
-FHippocacheResult UHippocacheBlueprintLibrary::ExecuteHippopForProperty(const UObject* WorldContextObject, FName Collection, const FString& Key, FProperty* ValueProperty, void* ValuePtr)
+FHippocacheResult UHippocacheBlueprintLibrary::ExecuteHippopForProperty(const UObject* WorldContextObject, FName Collection, const FHippocacheKey& Key, FProperty* ValueProperty, void* ValuePtr)
 {
+	using namespace HippocacheBlueprintLibraryPrivate;
+
 	if (!ValueProperty || !ValuePtr)
 	{
 		return FHippocacheResult::Error(EHippocacheErrorCode::InvalidValue, TEXT("Invalid property or value pointer"), TEXT("ExecuteHippopForProperty"));
 	}
 	
-	// Check if it's a struct property - handle with FInstancedStruct
-	if (FStructProperty* StructProp = CastField<FStructProperty>(ValueProperty))
+	switch (ResolvePropertyKind(ValueProperty))
+	{
+	case EPropertyKind::Struct:
 	{
-		UScriptStruct* StructType = StructProp->Struct;
+		UScriptStruct* StructType = static_cast<FStructProperty*>(ValueProperty)->Struct;
 		if (!StructType)
 		{
 			return FHippocacheResult::Error(EHippocacheErrorCode::UnsupportedType, TEXT("Invalid struct type"), TEXT("ExecuteHippopForProperty"));
 		}
 		
-		// Convert all structs to FInstancedStruct and let the template Hippop handle it
-		FInstancedStruct InstancedStruct;
-		FHippocacheResult Result = ExecuteHippopWithType(WorldContextObject, Collection, Key, InstancedStruct);
-		if (Result.IsSuccess() && InstancedStruct.IsValid() && InstancedStruct.GetScriptStruct() == StructType)
+		UHippocacheSubsystem* Subsystem = nullptr;
+		FHippocacheResult Result = GetSubsystemSafe(WorldContextObject, Subsystem);
+		if (Result.IsError())
 		{
-			// Copy the struct data back to the original memory location
-			StructType->CopyScriptStruct(ValuePtr, InstancedStruct.GetMemory());
+			return Result;
 		}
-		else if (Result.IsSuccess())
+
+		// The type is checked and the value copied straight into the Blueprint's output memory
+		return Subsystem->GetStruct(Collection, Key, StructType, ValuePtr);
+	}
+	case EPropertyKind::Bool:
+	{
+		bool Value = false;
+		FHippocacheResult Result = ExecuteHippopWithType(WorldContextObject, Collection, Key, Value);
+		if (Result.IsSuccess())
 		{
-			return FHippocacheResult::Error(EHippocacheErrorCode::TypeMismatch, 
-				TEXT("Retrieved struct type does not match expected type"), 
-				FString::Printf(TEXT("Expected: %s"), *StructType->GetName()));
+			static_cast<FBoolProperty*>(ValueProperty)->SetPropertyValue(ValuePtr, Value);
 		}
 		return Result;
 	}
-	else
+	case EPropertyKind::Byte:
+		return ExecuteHippopWithType(WorldContextObject, Collection, Key, *static_cast<uint8*>(ValuePtr));
+	case EPropertyKind::Int:
+		return ExecuteHippopWithType(WorldContextObject, Collection, Key, *static_cast<int32*>(ValuePtr));
+	case EPropertyKind::Int64:
+		return ExecuteHippopWithType(WorldContextObject, Collection, Key, *static_cast<int64*>(ValuePtr));
+	case EPropertyKind::Float:
+		return ExecuteHippopWithType(WorldContextObject, Collection, Key, *static_cast<float*>(ValuePtr));
+	case EPropertyKind::Double:
+		return ExecuteHippopWithType(WorldContextObject, Collection, Key, *static_cast<double*>(ValuePtr));
+	case EPropertyKind::String:
+		return ExecuteHippopWithType(WorldContextObject, Collection, Key, *static_cast<FString*>(ValuePtr));
+	case EPropertyKind::Name:
+		return ExecuteHippopWithType(WorldContextObject, Collection, Key, *static_cast<FName*>(ValuePtr));
+	case EPropertyKind::Generic:
 	{
-		// All non-struct types: retrieve FVariant wrapper via FInstancedStruct
 		UHippocacheSubsystem* Subsystem = nullptr;
 		FHippocacheResult Result = GetSubsystemSafe(WorldContextObject, Subsystem);
 		if (Result.IsError())
@@ -901,41 +1133,27 @@ FHippocacheResult UHippocacheBlueprintLibrary::ExecuteHippopForProperty(const UO
 			return Result;
 		}
 
-		// Retrieve FVariantWrapper from storage
-		FInstancedStruct InstancedStruct;
-		Result = Subsystem->GetStruct(Collection, Key, InstancedStruct);
-		if (Result.IsError())
+		// The value is copied into the Blueprint's output memory by the property itself
+		bool bSameType = true;
+		Result = Subsystem->ReadStructTyped<FHippocachePropertyValue>(Collection, Key, [ValueProperty, ValuePtr, &bSameType](const FHippocachePropertyValue& Value)
 		{
-			return Result;
-		}
-
-		// Extract FVariantWrapper and convert back to property
-		if (InstancedStruct.IsValid() && InstancedStruct.GetScriptStruct() == FVariantWrapper::StaticStruct())
-		{
-			const FVariantWrapper* Wrapper = InstancedStruct.GetPtr<FVariantWrapper>();
-			if (!Wrapper)
-			{
-				return FHippocacheResult::Error(EHippocacheErrorCode::TypeMismatch, 
-					TEXT("Retrieved InstancedStruct does not contain valid FVariantWrapper"), 
-					TEXT("ExecuteHippopForProperty"));
-			}
-
-			// Convert variant back to property
-			FVariant Variant = Wrapper->GetVariant();
-			if (!VariantToProperty(Variant, ValueProperty, ValuePtr))
+			bSameType = Value.IsSameType(ValueProperty);
+			if (bSameType)
 			{
-				return FHippocacheResult::Error(EHippocacheErrorCode::TypeMismatch, 
-					FString::Printf(TEXT("Cannot convert FVariant back to property type: %s"), *ValueProperty->GetClass()->GetName()), 
-					TEXT("ExecuteHippopForProperty"));
+				Value.CopyTo(ValueProperty, ValuePtr);
 			}
-
-			return FHippocacheResult::Success();
-		}
-		else
+		});
+		if (Result.IsSuccess() && !bSameType)
 		{
 			return FHippocacheResult::Error(EHippocacheErrorCode::TypeMismatch, 
-				TEXT("Retrieved data is not a FVariantWrapper"), 
-				TEXT("ExecuteHippopForProperty"));
+				TEXT("Cached value is of another property type"), 
+				FString::Printf(TEXT("Collection: %s, Key: %s, Expected: %s"), *Collection.ToString(), *Key.GetKey(), *ValueProperty->GetCPPType()));
 		}
+		return Result;
+	}
+	default:
+		return FHippocacheResult::Error(EHippocacheErrorCode::UnsupportedType, 
+			FString::Printf(TEXT("Unsupported property type: %s"), *ValueProperty->GetClass()->GetName()), 
+			TEXT("ExecuteHippopForProperty"));
 	}
 }
\ No newline at end of file
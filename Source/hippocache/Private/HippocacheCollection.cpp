@@ -0,0 +1,1453 @@
+#include "HippocacheCollection.h"
+#include "HippocacheEpoch.h"
+#include "HippocacheSlabAllocator.h"
+#include "HippocacheTimingWheel.h"
+#include "HAL/PlatformProcess.h"
+
+#if PLATFORM_CPU_X86_FAMILY
+#include <emmintrin.h>
+#endif
+
+namespace HippocacheCollectionPrivate
+{
+	/** Slots matched together by one group probe. */
+	constexpr int32 GroupWidth = 16;
+
+	/** Smallest table a shard ever uses: a single group. */
+	constexpr int32 MinTableCapacity = GroupWidth;
+
+	/** Control byte of a never-used slot. Ends a probe sequence. */
+	constexpr uint8 CtrlEmpty = 0x80;
+
+	/** Control byte of a removed slot. Probing continues past it. */
+	constexpr uint8 CtrlDeleted = 0xFE;
+
+	/** Full slots store these low 7 bits of the hash (high bit clear). */
+	FORCEINLINE uint8 H2(uint64 Hash)
+	{
+		return static_cast<uint8>(Hash & 0x7F);
+	}
+
+	/** Group the probe sequence for Hash starts at. Uses bits disjoint from H2 and from the shard index. */
+	FORCEINLINE uint32 H1(uint64 Hash)
+	{
+		return static_cast<uint32>(Hash >> 7);
+	}
+
+	/** Bitmasks (bit N = slot N) of a 16-slot control group. */
+	struct FGroupMatch
+	{
+#if PLATFORM_CPU_X86_FAMILY
+		explicit FGroupMatch(const uint8* Controls)
+			: Bytes(_mm_load_si128(reinterpret_cast<const __m128i*>(Controls)))
+		{}
+
+		uint32 Match(uint8 Hash2) const
+		{
+			return static_cast<uint32>(_mm_movemask_epi8(_mm_cmpeq_epi8(Bytes, _mm_set1_epi8(static_cast<char>(Hash2)))));
+		}
+
+		uint32 MatchEmpty() const
+		{
+			return Match(CtrlEmpty);
+		}
+
+		uint32 MatchEmptyOrDeleted() const
+		{
+			// Both special values have the high bit set; full slots don't
+			return static_cast<uint32>(_mm_movemask_epi8(Bytes));
+		}
+
+		__m128i Bytes;
+#else
+		explicit FGroupMatch(const uint8* Controls)
+		{
+			FMemory::Memcpy(Bytes, Controls, GroupWidth);
+		}
+
+		uint32 Match(uint8 Hash2) const
+		{
+			uint32 Mask = 0;
+			for (int32 Index = 0; Index < GroupWidth; ++Index)
+			{
+				Mask |= static_cast<uint32>(Bytes[Index] == Hash2) << Index;
+			}
+			return Mask;
+		}
+
+		uint32 MatchEmpty() const
+		{
+			return Match(CtrlEmpty);
+		}
+
+		uint32 MatchEmptyOrDeleted() const
+		{
+			uint32 Mask = 0;
+			for (int32 Index = 0; Index < GroupWidth; ++Index)
+			{
+				Mask |= static_cast<uint32>(Bytes[Index] >> 7) << Index;
+			}
+			return Mask;
+		}
+
+		uint8 Bytes[GroupWidth];
+#endif
+	};
+
+	/** Writes a control byte that lock-free readers may be loading concurrently. */
+	FORCEINLINE void StoreControl(uint8* Controls, int32 SlotIndex, uint8 Value)
+	{
+		FPlatformAtomics::AtomicStore_Relaxed(reinterpret_cast<volatile int8*>(Controls + SlotIndex), static_cast<int8>(Value));
+	}
+
+	/** Expiry records a sweep slice processes between reads of the clock. */
+	constexpr int32 SweepClockInterval = 64;
+
+	/** Expired items readers may queue per shard; past that they are left to the sweep. */
+	constexpr int32 MaxQueuedExpired = 256;
+
+	/**
+	 * Probes Table for an entry with Hash that KeyMatches accepts. The table type is a template
+	 * parameter only because FHippocacheCollection::FTable is private.
+	 */
+	template<typename TableType, typename KeyMatchType>
+	FHippocacheEntry* ProbeTable(const TableType& Table, uint64 Hash, KeyMatchType&& KeyMatches, int32* OutSlotIndex)
+	{
+		const uint8 Hash2 = H2(Hash);
+		const uint32 GroupMask = static_cast<uint32>(Table.Capacity / GroupWidth - 1);
+		uint32 Group = H1(Hash) & GroupMask;
+		for (uint32 Probe = 0; Probe <= GroupMask; Group = (Group + ++Probe) & GroupMask)
+		{
+			const int32 GroupStart = static_cast<int32>(Group) * GroupWidth;
+			const FGroupMatch Match(Table.Controls + GroupStart);
+			for (uint32 Candidates = Match.Match(Hash2); Candidates; Candidates &= Candidates - 1)
+			{
+				const int32 SlotIndex = GroupStart + static_cast<int32>(FMath::CountTrailingZeros(Candidates));
+
+				// A concurrently cleared slot reads as nullptr; a reused one fails the key check
+				FHippocacheEntry* Entry = Table.Slots[SlotIndex].load(std::memory_order_acquire);
+				if (Entry && Entry->Hash == Hash && KeyMatches(*Entry))
+				{
+					if (OutSlotIndex)
+					{
+						*OutSlotIndex = SlotIndex;
+					}
+					return Entry;
+				}
+			}
+			if (Match.MatchEmpty())
+			{
+				return nullptr;
+			}
+		}
+		return nullptr;
+	}
+}
+
+struct FHippocacheCollection::FExpiredNotice
+{
+	FHippocacheExpiryRecord Record;
+	FExpiredNotice* Next = nullptr;
+};
+
+FHippocacheCollection::FTable::FTable(int32 InCapacity)
+	: Capacity(InCapacity)
+	, Controls(static_cast<uint8*>(FMemory::Malloc(InCapacity, HippocacheCollectionPrivate::GroupWidth)))
+	, Slots(MakeUnique<std::atomic<FHippocacheEntry*>[]>(InCapacity))
+{
+	check(FMath::IsPowerOfTwo(InCapacity) && InCapacity >= HippocacheCollectionPrivate::GroupWidth);
+	FMemory::Memset(Controls, HippocacheCollectionPrivate::CtrlEmpty, Capacity);
+	for (int32 Index = 0; Index < Capacity; ++Index)
+	{
+		Slots[Index].store(nullptr, std::memory_order_relaxed);
+	}
+}
+
+FHippocacheCollection::FTable::~FTable()
+{
+	FMemory::Free(Controls);
+}
+
+FHippocacheCollection::FHippocacheCollection(FName InName, int32 InShardCount, EHippocacheIndexType InIndexType, EHippocacheValueAllocator InValueAllocator, const UScriptStruct* InValueType)
+	: Name(InName)
+	, IndexType(InIndexType)
+	, ValueAllocator(InValueAllocator)
+	, ValueType(InValueType)
+	, ShardMask(0)
+{
+	check(InShardCount > 0 && FMath::IsPowerOfTwo(InShardCount));
+
+	if (ValueType)
+	{
+		// Typed stores are keyed by a TMap and read under the shard lock, and own their value memory
+		ValueStride = Align(ValueType->GetStructureSize(), ValueType->GetMinAlignment());
+		IndexType = EHippocacheIndexType::TMap;
+		ValueAllocator = EHippocacheValueAllocator::Heap;
+	}
+
+	Shards.Reserve(InShardCount);
+	for (int32 Index = 0; Index < InShardCount; ++Index)
+	{
+		TUniquePtr<FShard> Shard = MakeUnique<FShard>();
+		if (IndexType == EHippocacheIndexType::FlatTable)
+		{
+			Shard->Table.store(new FTable(HippocacheCollectionPrivate::MinTableCapacity), std::memory_order_relaxed);
+		}
+		if (ValueAllocator == EHippocacheValueAllocator::Slab)
+		{
+			Shard->Slab = new FHippocacheSlabAllocator();
+		}
+		Shards.Add(MoveTemp(Shard));
+	}
+	ShardMask = static_cast<uint32>(InShardCount - 1);
+}
+
+FHippocacheCollection::~FHippocacheCollection()
+{
+	// The owner guarantees no reader can still reach this collection
+	for (const TUniquePtr<FShard>& Shard : Shards)
+	{
+		DeleteTableAndEntries(Shard->Table.exchange(nullptr, std::memory_order_relaxed));
+		for (const TPair<FString, FHippocacheEntry*>& Pair : Shard->Index)
+		{
+			DestroyEntry(Pair.Value);
+		}
+
+		ResetTypedStore(Shard->Typed);
+		DiscardQueuedExpired(*Shard);
+
+		// Entries retired earlier may still be waiting to return their blocks. FHippocacheEpoch destroys
+		// retired objects in retirement order, whichever threads reclaim, so the slab goes after them.
+		if (Shard->Slab)
+		{
+			FHippocacheEpoch::Retire(Shard->Slab);
+		}
+	}
+}
+
+FHippocacheCollection::FShard& FHippocacheCollection::GetShard(uint64 Hash) const
+{
+	return *Shards[static_cast<uint32>(Hash >> 48) & ShardMask];
+}
+
+FHippocacheEntry* FHippocacheCollection::FindEntry(const FTable& Table, const FString& Key, uint64 Hash, int32* OutSlotIndex)
+{
+	return HippocacheCollectionPrivate::ProbeTable(Table, Hash, [&Key](const FHippocacheEntry& Entry)
+	{
+		return Entry.Key.Equals(Key, ESearchCase::IgnoreCase);
+	}, OutSlotIndex);
+}
+
+FHippocacheEntry* FHippocacheCollection::FindEntryByAddress(const FTable& Table, uint64 Hash, const FHippocacheEntry* Entry, int32* OutSlotIndex)
+{
+	return HippocacheCollectionPrivate::ProbeTable(Table, Hash, [Entry](const FHippocacheEntry& Candidate)
+	{
+		return &Candidate == Entry;
+	}, OutSlotIndex);
+}
+
+int32 FHippocacheCollection::FindInsertSlot(const FTable& Table, uint64 Hash)
+{
+	using namespace HippocacheCollectionPrivate;
+
+	const uint32 GroupMask = static_cast<uint32>(Table.Capacity / GroupWidth - 1);
+	uint32 Group = H1(Hash) & GroupMask;
+	for (uint32 Probe = 0; Probe <= GroupMask; Group = (Group + ++Probe) & GroupMask)
+	{
+		const int32 GroupStart = static_cast<int32>(Group) * GroupWidth;
+		if (const uint32 Available = FGroupMatch(Table.Controls + GroupStart).MatchEmptyOrDeleted())
+		{
+			return GroupStart + static_cast<int32>(FMath::CountTrailingZeros(Available));
+		}
+	}
+
+	// ReserveForInsert keeps the table below 7/8 full, so every probe sequence has a free slot
+	checkNoEntry();
+	return INDEX_NONE;
+}
+
+void FHippocacheCollection::StoreSlot(FTable& Table, int32 SlotIndex, FHippocacheEntry* Entry, uint64 Hash)
+{
+	Table.Slots[SlotIndex].store(Entry, std::memory_order_release);
+	HippocacheCollectionPrivate::StoreControl(Table.Controls, SlotIndex, HippocacheCollectionPrivate::H2(Hash));
+}
+
+void FHippocacheCollection::ClearSlot(FTable& Table, int32 SlotIndex)
+{
+	HippocacheCollectionPrivate::StoreControl(Table.Controls, SlotIndex, HippocacheCollectionPrivate::CtrlDeleted);
+	Table.Slots[SlotIndex].store(nullptr, std::memory_order_release);
+}
+
+void FHippocacheCollection::ReserveForInsert(FShard& Shard)
+{
+	FTable* Table = Shard.Table.load(std::memory_order_relaxed);
+
+	// Keep the table (deleted slots included) at most 7/8 full so every probe finds a free slot quickly
+	if ((Shard.NumItems + Shard.NumDeleted + 1) * 8 <= Table->Capacity * 7)
+	{
+		return;
+	}
+
+	// Size for live entries only; the rebuild drops every deleted slot
+	const int32 NewCapacity = FMath::Max(HippocacheCollectionPrivate::MinTableCapacity, static_cast<int32>(FMath::RoundUpToPowerOfTwo((Shard.NumItems + 1) * 2)));
+	FTable* NewTable = new FTable(NewCapacity);
+
+	for (int32 Index = 0; Index < Table->Capacity; ++Index)
+	{
+		if (FHippocacheEntry* Entry = Table->Slots[Index].load(std::memory_order_relaxed))
+		{
+			StoreSlot(*NewTable, FindInsertSlot(*NewTable, Entry->Hash), Entry, Entry->Hash);
+		}
+	}
+
+	// Readers still probing the old table see the same entries until they leave their read scope
+	Shard.Table.store(NewTable, std::memory_order_release);
+	Shard.NumDeleted = 0;
+	FHippocacheEpoch::Retire(Table, &FHippocacheCollection::DeleteTable);
+}
+
+void FHippocacheCollection::DeleteTable(void* Table)
+{
+	delete static_cast<FTable*>(Table);
+}
+
+void FHippocacheCollection::DeleteTableAndEntries(void* Table)
+{
+	FTable* TypedTable = static_cast<FTable*>(Table);
+	if (!TypedTable)
+	{
+		return;
+	}
+	for (int32 Index = 0; Index < TypedTable->Capacity; ++Index)
+	{
+		if (FHippocacheEntry* Entry = TypedTable->Slots[Index].load(std::memory_order_relaxed))
+		{
+			DestroyEntry(Entry);
+		}
+	}
+	delete TypedTable;
+}
+
+void FHippocacheCollection::DeleteDetachedStorage(void* Storage)
+{
+	FDetachedStorage* TypedStorage = static_cast<FDetachedStorage*>(Storage);
+	if (FTable* Table = TypedStorage->Table)
+	{
+		for (int32 Index = 0; Index < Table->Capacity; ++Index)
+		{
+			if (FHippocacheEntry* Entry = Table->Slots[Index].load(std::memory_order_relaxed))
+			{
+				DestroyEntryInPlace(Entry);
+			}
+		}
+		delete Table;
+	}
+	delete TypedStorage->Slab;
+	delete TypedStorage;
+}
+
+FHippocacheEntry* FHippocacheCollection::CreateEntry(FShard& Shard, const FString& Key, uint64 Hash, const UScriptStruct* Struct, TFunctionRef<void(void* Memory)> Construct, FInstancedStruct* AdoptedValue, FTimespan TTL) const
+{
+	static_assert(sizeof(FHippocacheEntry) <= FHippocacheSlabAllocator::MaxBlockSize, "Entries must fit a slab block");
+	static_assert(alignof(FHippocacheEntry) <= FHippocacheSlabAllocator::BlockAlignment, "Entries must fit a slab block's alignment");
+
+	// Place a non-inline value right after the entry, so storing it takes a single allocation
+	int32 BlockSize = sizeof(FHippocacheEntry);
+	int32 BlockAlignment = alignof(FHippocacheEntry);
+	int32 ValueOffset = INDEX_NONE;
+	if (!AdoptedValue && !FCachedItem::CanStoreInline(Struct))
+	{
+		ValueOffset = Align(static_cast<int32>(sizeof(FHippocacheEntry)), Struct->GetMinAlignment());
+		BlockSize = ValueOffset + Struct->GetStructureSize();
+		BlockAlignment = FMath::Max(BlockAlignment, Struct->GetMinAlignment());
+	}
+
+	const bool bSlabAllocated = ValueAllocator == EHippocacheValueAllocator::Slab
+		&& BlockSize <= FHippocacheSlabAllocator::MaxBlockSize
+		&& BlockAlignment <= FHippocacheSlabAllocator::BlockAlignment;
+	uint8* Block = static_cast<uint8*>(bSlabAllocated ? Shard.Slab->Allocate(BlockSize) : FMemory::Malloc(BlockSize, BlockAlignment));
+
+	FHippocacheEntry* Entry = AdoptedValue
+		? new (Block) FHippocacheEntry(Key, Hash, MoveTemp(*AdoptedValue), TTL)
+		: new (Block) FHippocacheEntry(Key, Hash, Struct, Construct, TTL, ValueOffset != INDEX_NONE ? Block + ValueOffset : nullptr);
+	Entry->bSlabAllocated = bSlabAllocated;
+	return Entry;
+}
+
+void FHippocacheCollection::DestroyEntry(void* Entry)
+{
+	FHippocacheEntry* TypedEntry = static_cast<FHippocacheEntry*>(Entry);
+	const bool bSlabAllocated = TypedEntry->bSlabAllocated;
+	TypedEntry->~FHippocacheEntry();
+	if (bSlabAllocated)
+	{
+		FHippocacheSlabAllocator::Free(TypedEntry);
+	}
+	else
+	{
+		FMemory::Free(TypedEntry);
+	}
+}
+
+void FHippocacheCollection::DestroyEntryInPlace(FHippocacheEntry* Entry)
+{
+	const bool bSlabAllocated = Entry->bSlabAllocated;
+	Entry->~FHippocacheEntry();
+	if (!bSlabAllocated)
+	{
+		FMemory::Free(Entry);
+	}
+}
+
+void FHippocacheCollection::RetireEntry(FHippocacheEntry* Entry)
+{
+	FHippocacheEpoch::Retire(Entry, &FHippocacheCollection::DestroyEntry);
+}
+
+void FHippocacheCollection::AddTypedItem(FTypedStore& Store, const FString& Key, TFunctionRef<void(void* Memory)> Construct, uint64 Deadline) const
+{
+	const int32 Position = Store.Keys.Num();
+	if (Position == Store.Capacity)
+	{
+		// Values are relocated bitwise, the same assumption TArray makes for every element type
+		Store.Capacity = FMath::Max(16, Store.Capacity * 2);
+		Store.Values = static_cast<uint8*>(FMemory::Realloc(Store.Values, static_cast<SIZE_T>(Store.Capacity) * ValueStride, ValueType->GetMinAlignment()));
+	}
+
+	Construct(GetTypedValue(Store, Position));
+	Store.Keys.Add(Key);
+	Store.Deadlines.Add(Deadline);
+	Store.ScheduledDeadlines.Add(FHippocacheClock::Never);
+	Store.Index.Add(Key, Position);
+}
+
+void FHippocacheCollection::RemoveTypedItem(FTypedStore& Store, int32 Position) const
+{
+	const int32 LastPosition = Store.Keys.Num() - 1;
+	ValueType->DestroyStruct(GetTypedValue(Store, Position));
+	Store.Index.Remove(Store.Keys[Position]);
+	if (Position != LastPosition)
+	{
+		FMemory::Memcpy(GetTypedValue(Store, Position), GetTypedValue(Store, LastPosition), ValueType->GetStructureSize());
+		Store.Index.FindChecked(Store.Keys[LastPosition]) = Position;
+	}
+	Store.Keys.RemoveAtSwap(Position);
+	Store.Deadlines.RemoveAtSwap(Position);
+	Store.ScheduledDeadlines.RemoveAtSwap(Position);
+}
+
+void FHippocacheCollection::ResetTypedStore(FTypedStore& Store) const
+{
+	if (!Store.Values)
+	{
+		return;
+	}
+	ValueType->DestroyStruct(Store.Values, Store.Keys.Num());
+	FMemory::Free(Store.Values);
+	Store = FTypedStore();
+}
+
+FHippocacheResult FHippocacheCollection::Set(const FString& Key, uint64 Hash, const UScriptStruct* Struct, const void* Memory, FTimespan TTL)
+{
+	return StoreValue(Key, Hash, Struct, [Struct, Memory](void* Dest)
+	{
+		FCachedItem::CopyConstruct(Struct, Dest, Memory);
+	}, nullptr, TTL);
+}
+
+FHippocacheResult FHippocacheCollection::Set(const FString& Key, uint64 Hash, FInstancedStruct&& Value, FTimespan TTL)
+{
+	const UScriptStruct* Struct = Value.GetScriptStruct();
+	if (ValueType || FCachedItem::CanStoreInline(Struct))
+	{
+		// The value ends up in storage the collection owns, so there is no allocation to take over
+		return Set(Key, Hash, Struct, Value.GetMemory(), TTL);
+	}
+
+	return StoreValue(Key, Hash, Struct, [](void* Dest)
+	{
+		checkNoEntry();
+	}, &Value, TTL);
+}
+
+FHippocacheResult FHippocacheCollection::Emplace(const FString& Key, uint64 Hash, const UScriptStruct* Struct, TFunctionRef<void(void* Memory)> Construct, FTimespan TTL)
+{
+	return StoreValue(Key, Hash, Struct, Construct, nullptr, TTL);
+}
+
+FHippocacheResult FHippocacheCollection::StoreValue(const FString& Key, uint64 Hash, const UScriptStruct* Struct, TFunctionRef<void(void* Memory)> Construct, FInstancedStruct* AdoptedValue, FTimespan TTL)
+{
+	FShard& Shard = GetShard(Hash);
+
+	if (ValueType && Struct != ValueType)
+	{
+		return FHippocacheResult::Error(EHippocacheErrorCode::TypeMismatch, TEXT("Struct type mismatch"),
+			FString::Printf(TEXT("Collection: %s, Key: %s, Expected: %s, Given: %s"), *Name.ToString(), *Key, *ValueType->GetName(), *GetNameSafe(Struct)));
+	}
+
+	// Build a heap-valued FlatTable entry (and construct the value) before taking the lock. Inline values
+	// wait: overwriting an inline value in place needs no new entry at all. Slab entries wait too, since
+	// the shard's slab may only be used under its lock.
+	FHippocacheEntry* NewEntry = nullptr;
+	if (!ValueType && IndexType == EHippocacheIndexType::FlatTable && ValueAllocator != EHippocacheValueAllocator::Slab && !FCachedItem::CanStoreInline(Struct))
+	{
+		NewEntry = CreateEntry(Shard, Key, Hash, Struct, Construct, AdoptedValue, TTL);
+	}
+
+	FWriteScopeLock WriteLock(Shard.Lock);
+	StoreValueLocked(Shard, Key, Hash, Struct, Construct, AdoptedValue, TTL, NewEntry);
+	return FHippocacheResult::Success();
+}
+
+void FHippocacheCollection::StoreValueLocked(FShard& Shard, const FString& Key, uint64 Hash, const UScriptStruct* Struct, TFunctionRef<void(void* Memory)> Construct, FInstancedStruct* AdoptedValue, FTimespan TTL, FHippocacheEntry* NewEntry)
+{
+	RemoveQueuedExpired(Shard);
+
+	if (ValueType)
+	{
+		FTypedStore& Store = Shard.Typed;
+		const uint64 Deadline = FHippocacheClock::Deadline(FHippocacheClock::Now(), TTL);
+		int32 Position = INDEX_NONE;
+		if (const int32* Found = Store.Index.Find(Key))
+		{
+			Position = *Found;
+			uint8* Value = GetTypedValue(Store, Position);
+			ValueType->DestroyStruct(Value);
+			Construct(Value);
+			Store.Deadlines[Position] = Deadline;
+		}
+		else
+		{
+			AddTypedItem(Store, Key, Construct, Deadline);
+			Position = Store.Keys.Num() - 1;
+			++Shard.NumItems;
+		}
+		ScheduleExpiry(Shard, Key, Hash, Deadline, nullptr, Store.ScheduledDeadlines[Position]);
+		return;
+	}
+
+	if (IndexType == EHippocacheIndexType::TMap)
+	{
+		// An entry's allocation is sized for its value, so only a value that fits the same storage is
+		// rebuilt in place. An adopted value replaces the entry rather than being copied into it.
+		FHippocacheEntry*& Entry = Shard.Index.FindOrAdd(Key);
+		if (Entry && !AdoptedValue && Entry->Item.ReconstructInPlace(Struct, Construct, TTL))
+		{
+			ScheduleExpiry(Shard, Key, Hash, Entry->Item.Deadline, Entry, Entry->ScheduledDeadline);
+			return;
+		}
+
+		// TMap records find the item by key, so the replaced entry's record carries over to the new one
+		uint64 ScheduledDeadline = FHippocacheClock::Never;
+		if (Entry)
+		{
+			ScheduledDeadline = Entry->ScheduledDeadline;
+			DestroyEntry(Entry);
+		}
+		else
+		{
+			++Shard.NumItems;
+		}
+		Entry = CreateEntry(Shard, Key, Hash, Struct, Construct, AdoptedValue, TTL);
+		Entry->ScheduledDeadline = ScheduledDeadline;
+		ScheduleExpiry(Shard, Key, Hash, Entry->Item.Deadline, Entry, Entry->ScheduledDeadline);
+		return;
+	}
+
+	FTable* Table = Shard.Table.load(std::memory_order_relaxed);
+	int32 SlotIndex = INDEX_NONE;
+	FHippocacheEntry* ReplacedEntry = FindEntry(*Table, Key, Hash, &SlotIndex);
+	if (ReplacedEntry && ReplacedEntry->Item.IsInline() && FCachedItem::CanStoreInline(Struct))
+	{
+		WriteInlineItem(*ReplacedEntry, [&]()
+		{
+			ReplacedEntry->Item.ReconstructInPlace(Struct, Construct, TTL);
+		});
+		ScheduleExpiry(Shard, Key, Hash, ReplacedEntry->Item.Deadline, ReplacedEntry, ReplacedEntry->ScheduledDeadline);
+		return;
+	}
+
+	if (!NewEntry)
+	{
+		NewEntry = CreateEntry(Shard, Key, Hash, Struct, Construct, AdoptedValue, TTL);
+	}
+
+	if (ReplacedEntry)
+	{
+		Table->Slots[SlotIndex].store(NewEntry, std::memory_order_release);
+		RetireEntry(ReplacedEntry);
+	}
+	else
+	{
+		ReserveForInsert(Shard);
+		Table = Shard.Table.load(std::memory_order_relaxed);
+
+		SlotIndex = FindInsertSlot(*Table, Hash);
+		if (Table->Controls[SlotIndex] == HippocacheCollectionPrivate::CtrlDeleted)
+		{
+			--Shard.NumDeleted;
+		}
+		StoreSlot(*Table, SlotIndex, NewEntry, Hash);
+		++Shard.NumItems;
+	}
+	ScheduleExpiry(Shard, Key, Hash, NewEntry->Item.Deadline, NewEntry, NewEntry->ScheduledDeadline);
+}
+
+void FHippocacheCollection::ScheduleExpiry(FShard& Shard, const FString& Key, uint64 Hash, uint64 Deadline, const FHippocacheEntry* Entry, uint64& ScheduledDeadline) const
+{
+	// Rewriting an item with the same TTL pushes its deadline out, so the common case keeps the record it has
+	if (Deadline == FHippocacheClock::Never || (ScheduledDeadline != FHippocacheClock::Never && ScheduledDeadline <= Deadline))
+	{
+		return;
+	}
+	ScheduledDeadline = Deadline;
+	if (!Shard.ExpiryWheel)
+	{
+		Shard.ExpiryWheel = MakeUnique<FHippocacheTimingWheel>(FHippocacheClock::Now());
+	}
+
+	FHippocacheExpiryRecord Record;
+	Record.Deadline = Deadline;
+	Record.Hash = Hash;
+	if (IndexType == EHippocacheIndexType::TMap)
+	{
+		// Flat tables find the entry by its address instead, so only TMap and typed shards pay for a copy of the key
+		Record.Key = Key;
+	}
+	else
+	{
+		Record.Entry = Entry;
+	}
+	Shard.ExpiryWheel->Schedule(MoveTemp(Record));
+}
+
+bool FHippocacheCollection::RemoveDueItem(FShard& Shard, FHippocacheExpiryRecord& Record, uint64 Now)
+{
+	// A live item that was written again keeps its record, moved on to the deadline it has now
+	auto Rearm = [&Shard, &Record](uint64 Deadline, uint64& ScheduledDeadline)
+	{
+		if (ScheduledDeadline != Record.Deadline)
+		{
+			return;
+		}
+		ScheduledDeadline = Deadline;
+		if (Deadline != FHippocacheClock::Never)
+		{
+			Record.Deadline = Deadline;
+			Shard.ExpiryWheel->Schedule(MoveTemp(Record));
+		}
+	};
+
+	if (ValueType)
+	{
+		FTypedStore& Store = Shard.Typed;
+		const int32* Position = Store.Index.Find(Record.Key);
+		if (!Position)
+		{
+			return false;
+		}
+		if (!FHippocacheClock::HasPassed(Store.Deadlines[*Position], Now))
+		{
+			Rearm(Store.Deadlines[*Position], Store.ScheduledDeadlines[*Position]);
+			return false;
+		}
+		RemoveTypedItem(Store, *Position);
+		--Shard.NumItems;
+		return true;
+	}
+
+	if (IndexType == EHippocacheIndexType::TMap)
+	{
+		FHippocacheEntry** Found = Shard.Index.Find(Record.Key);
+		if (!Found)
+		{
+			return false;
+		}
+		FHippocacheEntry* Entry = *Found;
+		if (!FHippocacheClock::HasPassed(Entry->Item.Deadline, Now))
+		{
+			Rearm(Entry->Item.Deadline, Entry->ScheduledDeadline);
+			return false;
+		}
+		DestroyEntry(Entry);
+		Shard.Index.Remove(Record.Key);
+		--Shard.NumItems;
+		return true;
+	}
+
+	FTable* Table = Shard.Table.load(std::memory_order_relaxed);
+	int32 SlotIndex = INDEX_NONE;
+	FHippocacheEntry* Entry = FindEntryByAddress(*Table, Record.Hash, Record.Entry, &SlotIndex);
+	if (!Entry)
+	{
+		return false;
+	}
+	if (!FHippocacheClock::HasPassed(Entry->Item.Deadline, Now))
+	{
+		Rearm(Entry->Item.Deadline, Entry->ScheduledDeadline);
+		return false;
+	}
+	ClearSlot(*Table, SlotIndex);
+	--Shard.NumItems;
+	++Shard.NumDeleted;
+	RetireEntry(Entry);
+	return true;
+}
+
+void FHippocacheCollection::QueueExpired(const FShard& Shard, const FString& Key, uint64 Hash, uint64 Deadline, const FHippocacheEntry* Entry) const
+{
+	// Typed items have no entry to remember the notice by; the cap alone bounds how often they are queued
+	if (Entry && Entry->QueuedDeadline.exchange(Deadline, std::memory_order_relaxed) == Deadline)
+	{
+		return;
+	}
+	if (Shard.NumExpiredQueued.fetch_add(1, std::memory_order_relaxed) >= HippocacheCollectionPrivate::MaxQueuedExpired)
+	{
+		Shard.NumExpiredQueued.fetch_sub(1, std::memory_order_relaxed);
+		return;
+	}
+
+	FExpiredNotice* Notice = new FExpiredNotice;
+	Notice->Record.Deadline = Deadline;
+	Notice->Record.Hash = Hash;
+	if (IndexType == EHippocacheIndexType::TMap)
+	{
+		Notice->Record.Key = Key;
+	}
+	else
+	{
+		Notice->Record.Entry = Entry;
+	}
+
+	// The writer takes the whole list at once, so pushing can't meet a popped node again (no ABA)
+	FExpiredNotice* Head = Shard.ExpiredQueue.load(std::memory_order_relaxed);
+	do
+	{
+		Notice->Next = Head;
+	}
+	while (!Shard.ExpiredQueue.compare_exchange_weak(Head, Notice, std::memory_order_release, std::memory_order_relaxed));
+}
+
+int32 FHippocacheCollection::RemoveQueuedExpired(FShard& Shard)
+{
+	if (!Shard.ExpiredQueue.load(std::memory_order_relaxed))
+	{
+		return 0;
+	}
+
+	// A notice is just an expiry record that came due early, so it is checked against the item the same way
+	const uint64 Now = FHippocacheClock::Now();
+	int32 RemovedCount = 0;
+	int32 NumNotices = 0;
+	for (FExpiredNotice* Notice = Shard.ExpiredQueue.exchange(nullptr, std::memory_order_acquire); Notice; ++NumNotices)
+	{
+		FExpiredNotice* Next = Notice->Next;
+		if (RemoveDueItem(Shard, Notice->Record, Now))
+		{
+			++RemovedCount;
+		}
+		delete Notice;
+		Notice = Next;
+	}
+	Shard.NumExpiredQueued.fetch_sub(NumNotices, std::memory_order_relaxed);
+	return RemovedCount;
+}
+
+void FHippocacheCollection::DiscardQueuedExpired(FShard& Shard)
+{
+	// Only the notices taken here are uncounted; ones pushed meanwhile are counted and freed with the next batch
+	int32 NumNotices = 0;
+	for (FExpiredNotice* Notice = Shard.ExpiredQueue.exchange(nullptr, std::memory_order_acquire); Notice; ++NumNotices)
+	{
+		FExpiredNotice* Next = Notice->Next;
+		delete Notice;
+		Notice = Next;
+	}
+	Shard.NumExpiredQueued.fetch_sub(NumNotices, std::memory_order_relaxed);
+}
+
+void FHippocacheCollection::SnapshotInlineItem(const FHippocacheEntry& Entry, const UScriptStruct*& OutStruct, uint64& OutDeadline, uint8* OutData)
+{
+	const FCachedItem& Item = Entry.Item;
+	for (;;)
+	{
+		const uint32 Sequence = Entry.Sequence.load(std::memory_order_acquire);
+		if (Sequence & 1)
+		{
+			FPlatformProcess::YieldThread();
+			continue;
+		}
+
+		OutStruct = Item.InlineStruct;
+		OutDeadline = Item.Deadline;
+		FMemory::Memcpy(OutData, Item.InlineData, FCachedItem::InlineCapacity);
+
+		std::atomic_thread_fence(std::memory_order_acquire);
+		if (Entry.Sequence.load(std::memory_order_relaxed) == Sequence)
+		{
+			return;
+		}
+	}
+}
+
+void FHippocacheCollection::WriteInlineItem(FHippocacheEntry& Entry, TFunctionRef<void()> Write)
+{
+	// Seqlock write: lock-free readers that overlap it see an odd or changed Sequence and retry. The shard
+	// lock doesn't exclude UpdateInline, so the odd value is claimed with a compare-exchange.
+	uint32 Sequence = Entry.Sequence.load(std::memory_order_relaxed);
+	for (;;)
+	{
+		if (Sequence & 1)
+		{
+			FPlatformProcess::YieldThread();
+			Sequence = Entry.Sequence.load(std::memory_order_relaxed);
+		}
+		else if (Entry.Sequence.compare_exchange_weak(Sequence, Sequence + 1, std::memory_order_acquire, std::memory_order_relaxed))
+		{
+			break;
+		}
+	}
+	std::atomic_thread_fence(std::memory_order_release);
+	Write();
+	Entry.Sequence.store(Sequence + 2, std::memory_order_release);
+}
+
+FHippocacheResult FHippocacheCollection::ReadValue(const FString& Key, uint64 Hash, TFunctionRef<FHippocacheResult(const UScriptStruct*, const void*)> Reader) const
+{
+	const FShard& Shard = GetShard(Hash);
+
+	if (ValueType)
+	{
+		FReadScopeLock ReadLock(Shard.Lock);
+		const FTypedStore& Store = Shard.Typed;
+		const int32* Position = Store.Index.Find(Key);
+		if (!Position)
+		{
+			return FHippocacheResult::Lazy(EHippocacheErrorCode::ItemNotFound, TEXT("Item not found"), Name, Key, Hash);
+		}
+		if (FHippocacheClock::HasPassed(Store.Deadlines[*Position]))
+		{
+			QueueExpired(Shard, Key, Hash, Store.Deadlines[*Position], nullptr);
+			return FHippocacheResult::Lazy(EHippocacheErrorCode::ItemExpired, TEXT("Item has expired"), Name, Key, Hash);
+		}
+		return Reader(ValueType, GetTypedValue(Store, *Position));
+	}
+
+	// Exactly one of these guards is engaged, depending on the index type
+	TOptional<FReadScopeLock> ReadLock;
+	TOptional<FHippocacheEpoch::FReadScope> EpochScope;
+
+	const FHippocacheEntry* FoundEntry = nullptr;
+	if (IndexType == EHippocacheIndexType::TMap)
+	{
+		ReadLock.Emplace(Shard.Lock);
+		FHippocacheEntry* const* Found = Shard.Index.Find(Key);
+		FoundEntry = Found ? *Found : nullptr;
+	}
+	else
+	{
+		// No lock: the entry and the table it came from stay alive until this scope ends
+		EpochScope.Emplace();
+		FoundEntry = FindEntry(*Shard.Table.load(std::memory_order_acquire), Key, Hash);
+	}
+
+	if (!FoundEntry)
+	{
+		return FHippocacheResult::Lazy(EHippocacheErrorCode::ItemNotFound, TEXT("Item not found"), Name, Key, Hash);
+	}
+
+	const FCachedItem& FoundItem = FoundEntry->Item;
+	const UScriptStruct* Struct = FoundItem.GetScriptStruct();
+	const void* Memory = FoundItem.GetMemory();
+	uint64 Deadline = FoundItem.Deadline;
+
+	// An inline value can be rewritten in place by a writer we don't exclude, so copy it out under the
+	// entry's sequence. An entry never switches between inline and heap storage while it is published.
+	alignas(16) uint8 InlineSnapshot[FCachedItem::InlineCapacity];
+	if (!ReadLock.IsSet() && FoundItem.IsInline())
+	{
+		SnapshotInlineItem(*FoundEntry, Struct, Deadline, InlineSnapshot);
+		Memory = InlineSnapshot;
+	}
+
+	// Removing needs the write lock, so leave that to the shard's next writer
+	if (FHippocacheClock::HasPassed(Deadline))
+	{
+		QueueExpired(Shard, Key, Hash, Deadline, FoundEntry);
+		return FHippocacheResult::Lazy(EHippocacheErrorCode::ItemExpired, TEXT("Item has expired"), Name, Key, Hash);
+	}
+
+	if (!Struct || !Memory)
+	{
+		return FHippocacheResult::Error(EHippocacheErrorCode::TypeMismatch, TEXT("Type mismatch - expected Struct"), FString::Printf(TEXT("Collection: %s, Key: %s"), *Name.ToString(), *Key));
+	}
+
+	// Update access time for LRU tracking (future use) - disabled for performance
+	// FoundItem.UpdateAccessTime();
+
+	return Reader(Struct, Memory);
+}
+
+FHippocacheResult FHippocacheCollection::Get(const FString& Key, uint64 Hash, FInstancedStruct& OutValue) const
+{
+	return ReadValue(Key, Hash, [&OutValue](const UScriptStruct* Struct, const void* Memory)
+	{
+		// Reuse OutValue's allocation when it already holds this type
+		if (OutValue.GetScriptStruct() == Struct)
+		{
+			Struct->CopyScriptStruct(OutValue.GetMutableMemory(), Memory);
+		}
+		else
+		{
+			OutValue.InitializeAs(Struct, static_cast<const uint8*>(Memory));
+		}
+		return FHippocacheResult::Success();
+	});
+}
+
+FHippocacheResult FHippocacheCollection::Get(const FString& Key, uint64 Hash, const UScriptStruct* Struct, void* OutMemory) const
+{
+	return ReadValue(Key, Hash, [this, &Key, Struct, OutMemory](const UScriptStruct* StoredStruct, const void* Memory)
+	{
+		if (StoredStruct != Struct)
+		{
+			return FHippocacheResult::Error(EHippocacheErrorCode::TypeMismatch, TEXT("Struct type mismatch"),
+				FString::Printf(TEXT("Collection: %s, Key: %s, Expected: %s, Stored: %s"), *Name.ToString(), *Key, *GetNameSafe(Struct), *StoredStruct->GetName()));
+		}
+		Struct->CopyScriptStruct(OutMemory, Memory);
+		return FHippocacheResult::Success();
+	});
+}
+
+FHippocacheResult FHippocacheCollection::Read(const FString& Key, uint64 Hash, TFunctionRef<void(const UScriptStruct* Struct, const void* Memory)> Visitor) const
+{
+	return ReadValue(Key, Hash, [&Visitor](const UScriptStruct* Struct, const void* Memory)
+	{
+		Visitor(Struct, Memory);
+		return FHippocacheResult::Success();
+	});
+}
+
+FHippocacheResult FHippocacheCollection::Update(const FString& Key, uint64 Hash, const UScriptStruct* ExpectedStruct, TFunctionRef<void(const UScriptStruct* Struct, void* Memory)> Mutator)
+{
+	FShard& Shard = GetShard(Hash);
+	FWriteScopeLock WriteLock(Shard.Lock);
+
+	auto CheckItem = [this, &Key, Hash, ExpectedStruct](const UScriptStruct* Struct, uint64 Deadline)
+	{
+		if (FHippocacheClock::HasPassed(Deadline))
+		{
+			return FHippocacheResult::Lazy(EHippocacheErrorCode::ItemExpired, TEXT("Item has expired"), Name, Key, Hash);
+		}
+		if (!Struct || (ExpectedStruct && Struct != ExpectedStruct))
+		{
+			return FHippocacheResult::Error(EHippocacheErrorCode::TypeMismatch, TEXT("Struct type mismatch"),
+				FString::Printf(TEXT("Collection: %s, Key: %s, Expected: %s, Stored: %s"), *Name.ToString(), *Key, *GetNameSafe(ExpectedStruct), *GetNameSafe(Struct)));
+		}
+		return FHippocacheResult::Success();
+	};
+
+	if (ValueType)
+	{
+		FTypedStore& Store = Shard.Typed;
+		const int32* Position = Store.Index.Find(Key);
+		if (!Position)
+		{
+			return FHippocacheResult::Lazy(EHippocacheErrorCode::ItemNotFound, TEXT("Item not found"), Name, Key, Hash);
+		}
+		FHippocacheResult Result = CheckItem(ValueType, Store.Deadlines[*Position]);
+		if (Result.IsSuccess())
+		{
+			Mutator(ValueType, GetTypedValue(Store, *Position));
+		}
+		return Result;
+	}
+
+	FTable* Table = nullptr;
+	int32 SlotIndex = INDEX_NONE;
+	FHippocacheEntry* Entry = nullptr;
+	if (IndexType == EHippocacheIndexType::TMap)
+	{
+		FHippocacheEntry** Found = Shard.Index.Find(Key);
+		Entry = Found ? *Found : nullptr;
+	}
+	else
+	{
+		Table = Shard.Table.load(std::memory_order_relaxed);
+		Entry = FindEntry(*Table, Key, Hash, &SlotIndex);
+	}
+
+	if (!Entry)
+	{
+		return FHippocacheResult::Lazy(EHippocacheErrorCode::ItemNotFound, TEXT("Item not found"), Name, Key, Hash);
+	}
+
+	// The write lock excludes every other writer, so the item can be inspected directly
+	FCachedItem& Item = Entry->Item;
+	const UScriptStruct* Struct = Item.GetScriptStruct();
+	FHippocacheResult Result = CheckItem(Struct, Item.Deadline);
+	if (Result.IsError())
+	{
+		return Result;
+	}
+
+	if (IndexType == EHippocacheIndexType::TMap)
+	{
+		// TMap readers hold the read lock, so nobody can see the value while it changes
+		Mutator(Struct, Item.GetMutableMemory());
+	}
+	else if (Item.IsInline())
+	{
+		// UpdateInline may change the value without the shard lock, so read it inside the write section too
+		WriteInlineItem(*Entry, [&]()
+		{
+			Mutator(Struct, Item.InlineData);
+		});
+	}
+	else
+	{
+		FHippocacheEntry* NewEntry = CreateEntry(Shard, Key, Hash, Struct, [&](void* Dest)
+		{
+			FCachedItem::CopyConstruct(Struct, Dest, Item.GetMemory());
+			Mutator(Struct, Dest);
+		}, nullptr, FTimespan::Zero());
+		NewEntry->Item.Deadline = Item.Deadline;
+		NewEntry->Item.LastAccessTime = Item.LastAccessTime;
+		Table->Slots[SlotIndex].store(NewEntry, std::memory_order_release);
+		RetireEntry(Entry);
+
+		// Flat table records name their entry, so the old entry's record no longer matches the item
+		ScheduleExpiry(Shard, Key, Hash, NewEntry->Item.Deadline, NewEntry, NewEntry->ScheduledDeadline);
+	}
+	return FHippocacheResult::Success();
+}
+
+FHippocacheResult FHippocacheCollection::UpdateInline(const FString& Key, uint64 Hash, const UScriptStruct* Struct, TFunctionRef<bool(void* Memory, bool bFound)> Op)
+{
+	check(FCachedItem::CanStoreInline(Struct));
+	FShard& Shard = GetShard(Hash);
+
+	auto MakeTypeMismatch = [this, &Key, Struct](const UScriptStruct* StoredStruct)
+	{
+		return FHippocacheResult::Error(EHippocacheErrorCode::TypeMismatch, TEXT("Struct type mismatch"),
+			FString::Printf(TEXT("Collection: %s, Key: %s, Expected: %s, Stored: %s"), *Name.ToString(), *Key, *Struct->GetName(), *GetNameSafe(StoredStruct)));
+	};
+
+	if (ValueType && Struct != ValueType)
+	{
+		return MakeTypeMismatch(ValueType);
+	}
+
+	if (!ValueType && IndexType == EHippocacheIndexType::FlatTable)
+	{
+		// Fast path: a live inline value is changed under its Sequence alone. The entry stays alive until
+		// this scope ends; if it is replaced or removed meanwhile, the op simply lands just before that.
+		FHippocacheEpoch::FReadScope EpochScope;
+		FHippocacheEntry* Entry = FindEntry(*Shard.Table.load(std::memory_order_acquire), Key, Hash);
+		if (Entry && Entry->Item.IsInline())
+		{
+			FCachedItem& Item = Entry->Item;
+			const UScriptStruct* StoredStruct = nullptr;
+			bool bLive = false;
+			WriteInlineItem(*Entry, [&]()
+			{
+				StoredStruct = Item.InlineStruct;
+				bLive = !Item.HasExpired();
+				if (bLive && StoredStruct == Struct)
+				{
+					Op(Item.InlineData, true);
+				}
+			});
+			if (bLive)
+			{
+				return StoredStruct == Struct ? FHippocacheResult::Success() : MakeTypeMismatch(StoredStruct);
+			}
+		}
+	}
+
+	// Missing, expired, or not in a FlatTable: decide under the shard lock, so only one writer creates the item
+	FWriteScopeLock WriteLock(Shard.Lock);
+
+	FHippocacheEntry* Entry = nullptr;
+	const UScriptStruct* StoredStruct = nullptr;
+	uint8* Memory = nullptr;
+	bool bExpired = false;
+	if (ValueType)
+	{
+		FTypedStore& Store = Shard.Typed;
+		if (const int32* Position = Store.Index.Find(Key))
+		{
+			StoredStruct = ValueType;
+			Memory = GetTypedValue(Store, *Position);
+			bExpired = FHippocacheClock::HasPassed(Store.Deadlines[*Position]);
+		}
+	}
+	else
+	{
+		if (IndexType == EHippocacheIndexType::TMap)
+		{
+			FHippocacheEntry** Found = Shard.Index.Find(Key);
+			Entry = Found ? *Found : nullptr;
+		}
+		else
+		{
+			Entry = FindEntry(*Shard.Table.load(std::memory_order_relaxed), Key, Hash);
+		}
+
+		if (Entry)
+		{
+			// Only the value itself changes outside the shard lock, so its type and expiration can be read here
+			StoredStruct = Entry->Item.GetScriptStruct();
+			Memory = Entry->Item.GetMutableMemory();
+			bExpired = Entry->Item.HasExpired();
+		}
+	}
+
+	if (StoredStruct && !bExpired)
+	{
+		if (StoredStruct != Struct)
+		{
+			return MakeTypeMismatch(StoredStruct);
+		}
+		if (Entry && IndexType == EHippocacheIndexType::FlatTable)
+		{
+			WriteInlineItem(*Entry, [&]()
+			{
+				Op(Memory, true);
+			});
+		}
+		else
+		{
+			Op(Memory, true);
+		}
+		return FHippocacheResult::Success();
+	}
+
+	alignas(16) uint8 Scratch[FCachedItem::InlineCapacity];
+	Struct->InitializeStruct(Scratch);
+	if (!Op(Scratch, false))
+	{
+		return bExpired
+			? FHippocacheResult::Lazy(EHippocacheErrorCode::ItemExpired, TEXT("Item has expired"), Name, Key, Hash)
+			: FHippocacheResult::Lazy(EHippocacheErrorCode::ItemNotFound, TEXT("Item not found"), Name, Key, Hash);
+	}
+
+	StoreValueLocked(Shard, Key, Hash, Struct, [Struct, &Scratch](void* Dest)
+	{
+		FMemory::Memcpy(Dest, Scratch, Struct->GetStructureSize());
+	}, nullptr, FTimespan::Zero(), nullptr);
+	return FHippocacheResult::Success();
+}
+
+FHippocacheResult FHippocacheCollection::Remove(const FString& Key, uint64 Hash)
+{
+	FShard& Shard = GetShard(Hash);
+
+	bool bRemoved = false;
+	{
+		FWriteScopeLock WriteLock(Shard.Lock);
+
+		if (ValueType)
+		{
+			if (const int32* Position = Shard.Typed.Index.Find(Key))
+			{
+				RemoveTypedItem(Shard.Typed, *Position);
+				--Shard.NumItems;
+				bRemoved = true;
+			}
+		}
+		else if (IndexType == EHippocacheIndexType::TMap)
+		{
+			FHippocacheEntry* RemovedEntry = nullptr;
+			if (Shard.Index.RemoveAndCopyValue(Key, RemovedEntry))
+			{
+				--Shard.NumItems;
+				DestroyEntry(RemovedEntry);
+				bRemoved = true;
+			}
+		}
+		else
+		{
+			FTable* Table = Shard.Table.load(std::memory_order_relaxed);
+			int32 SlotIndex = INDEX_NONE;
+			if (FHippocacheEntry* RemovedEntry = FindEntry(*Table, Key, Hash, &SlotIndex))
+			{
+				ClearSlot(*Table, SlotIndex);
+				--Shard.NumItems;
+				++Shard.NumDeleted;
+				RetireEntry(RemovedEntry);
+				bRemoved = true;
+			}
+		}
+
+		// After the key itself, so removing an item readers found expired still reports it removed
+		RemoveQueuedExpired(Shard);
+	}
+
+	if (!bRemoved)
+	{
+		return FHippocacheResult::Lazy(EHippocacheErrorCode::ItemNotFound, TEXT("Item not found"), Name, Key, Hash);
+	}
+	return FHippocacheResult::Success();
+}
+
+int32 FHippocacheCollection::Clear()
+{
+	int32 ClearedCount = 0;
+	for (const TUniquePtr<FShard>& Shard : Shards)
+	{
+		FWriteScopeLock WriteLock(Shard->Lock);
+		ClearedCount += Shard->NumItems;
+		Shard->ExpiryWheel.Reset();
+		DiscardQueuedExpired(*Shard);
+
+		if (ValueType)
+		{
+			ResetTypedStore(Shard->Typed);
+			Shard->NumItems = 0;
+			continue;
+		}
+
+		if (IndexType == EHippocacheIndexType::TMap)
+		{
+			// TMap readers hold the lock, so nothing can still see these entries. Slab blocks go with the slab.
+			for (const TPair<FString, FHippocacheEntry*>& Pair : Shard->Index)
+			{
+				DestroyEntryInPlace(Pair.Value);
+			}
+			Shard->Index.Empty();
+			Shard->NumItems = 0;
+			if (Shard->Slab)
+			{
+				delete Shard->Slab;
+				Shard->Slab = new FHippocacheSlabAllocator();
+			}
+			continue;
+		}
+
+		if (Shard->NumItems == 0 && Shard->NumDeleted == 0)
+		{
+			continue;
+		}
+
+		// Swap in an empty table; the old one and its entries go once current readers leave
+		FTable* OldTable = Shard->Table.exchange(new FTable(HippocacheCollectionPrivate::MinTableCapacity), std::memory_order_acq_rel);
+		Shard->NumItems = 0;
+		Shard->NumDeleted = 0;
+
+		if (Shard->Slab)
+		{
+			// The old slab's pages are released together once its entries are destroyed. Retired under
+			// the lock, after every entry this shard has retired, and FHippocacheEpoch keeps retirement
+			// order even when several threads reclaim at once, so those return their blocks first.
+			FDetachedStorage* Detached = new FDetachedStorage();
+			Detached->Table = OldTable;
+			Detached->Slab = Shard->Slab;
+			Shard->Slab = new FHippocacheSlabAllocator();
+			FHippocacheEpoch::Retire(Detached, &FHippocacheCollection::DeleteDetachedStorage);
+		}
+		else
+		{
+			FHippocacheEpoch::Retire(OldTable, &FHippocacheCollection::DeleteTableAndEntries);
+		}
+	}
+	return ClearedCount;
+}
+
+int32 FHippocacheCollection::Num() const
+{
+	int32 Count = 0;
+	for (const TUniquePtr<FShard>& Shard : Shards)
+	{
+		FReadScopeLock ReadLock(Shard->Lock);
+		Count += Shard->NumItems;
+	}
+	return Count;
+}
+
+int32 FHippocacheCollection::RemoveExpired()
+{
+	int32 RemovedCount = 0;
+	for (const TUniquePtr<FShard>& Shard : Shards)
+	{
+		FWriteScopeLock WriteLock(Shard->Lock);
+		RemovedCount += RemoveQueuedExpired(*Shard);
+		const uint64 Now = FHippocacheClock::Now();
+
+		if (ValueType)
+		{
+			// Walk backwards so the item moved into a removed slot has already been checked
+			FTypedStore& Store = Shard->Typed;
+			for (int32 Position = Store.Keys.Num() - 1; Position >= 0; --Position)
+			{
+				if (FCachedItem::HasExpired(Store.Deadlines[Position], Now))
+				{
+					RemoveTypedItem(Store, Position);
+					--Shard->NumItems;
+					++RemovedCount;
+				}
+			}
+			continue;
+		}
+
+		if (IndexType == EHippocacheIndexType::TMap)
+		{
+			for (auto ItemIt = Shard->Index.CreateIterator(); ItemIt; ++ItemIt)
+			{
+				if (ItemIt->Value->Item.HasExpired(Now))
+				{
+					DestroyEntry(ItemIt->Value);
+					ItemIt.RemoveCurrent();
+					--Shard->NumItems;
+					++RemovedCount;
+				}
+			}
+			continue;
+		}
+
+		FTable* Table = Shard->Table.load(std::memory_order_relaxed);
+		for (int32 Index = 0; Index < Table->Capacity; ++Index)
+		{
+			FHippocacheEntry* Entry = Table->Slots[Index].load(std::memory_order_relaxed);
+			if (Entry && Entry->Item.HasExpired(Now))
+			{
+				ClearSlot(*Table, Index);
+				--Shard->NumItems;
+				++Shard->NumDeleted;
+				RetireEntry(Entry);
+				++RemovedCount;
+			}
+		}
+	}
+	return RemovedCount;
+}
+
+bool FHippocacheCollection::SweepExpired(FHippocacheSweepBudget& Budget, FHippocacheSweepStats& Stats)
+{
+	while (SweepShard < Shards.Num())
+	{
+		if (Budget.ItemsLeft <= 0 || FPlatformTime::Seconds() >= Budget.EndTime)
+		{
+			return false;
+		}
+
+		FShard& Shard = *Shards[SweepShard];
+		bool bShardDone = true;
+		{
+			FWriteScopeLock WriteLock(Shard.Lock);
+			const double LockTime = FPlatformTime::Seconds();
+			const double SliceEndTime = FMath::Min(Budget.EndTime, LockTime + Budget.MaxLockSeconds);
+			Stats.ItemsRemoved += RemoveQueuedExpired(Shard);
+
+			if (Shard.ExpiryWheel)
+			{
+				// Records hold cache clock deadlines; the slice timer is only read every few records
+				const uint64 WheelTime = FHippocacheClock::Now();
+				int32 UntilClockCheck = HippocacheCollectionPrivate::SweepClockInterval;
+				FHippocacheExpiryRecord Record;
+				for (;;)
+				{
+					if (Budget.ItemsLeft <= 0)
+					{
+						bShardDone = false;
+						break;
+					}
+					if (--UntilClockCheck == 0)
+					{
+						UntilClockCheck = HippocacheCollectionPrivate::SweepClockInterval;
+						if (FPlatformTime::Seconds() >= SliceEndTime)
+						{
+							bShardDone = false;
+							break;
+						}
+					}
+					if (!Shard.ExpiryWheel->PopDue(WheelTime, Record))
+					{
+						break;
+					}
+
+					--Budget.ItemsLeft;
+					++Stats.ItemsExamined;
+					if (RemoveDueItem(Shard, Record, WheelTime))
+					{
+						++Stats.ItemsRemoved;
+					}
+				}
+			}
+
+			++Stats.LockHolds;
+			Stats.LongestLockHoldSeconds = FMath::Max(Stats.LongestLockHoldSeconds, FPlatformTime::Seconds() - LockTime);
+		}
+
+		if (bShardDone)
+		{
+			++SweepShard;
+		}
+	}
+
+	SweepShard = 0;
+	return true;
+}
+
+void FHippocacheCollection::ForEach(TFunctionRef<void(const FString& Key, const UScriptStruct* Struct, const void* Memory)> Visitor) const
+{
+	for (const TUniquePtr<FShard>& Shard : Shards)
+	{
+		// One clock reading per shard, taken before the visitor's work can push it far into the past
+		const uint64 Now = FHippocacheClock::Now();
+		if (ValueType)
+		{
+			FReadScopeLock ReadLock(Shard->Lock);
+			const FTypedStore& Store = Shard->Typed;
+			for (int32 Position = 0; Position < Store.Keys.Num(); ++Position)
+			{
+				if (!FCachedItem::HasExpired(Store.Deadlines[Position], Now))
+				{
+					Visitor(Store.Keys[Position], ValueType, GetTypedValue(Store, Position));
+				}
+			}
+			continue;
+		}
+
+		if (IndexType == EHippocacheIndexType::TMap)
+		{
+			FReadScopeLock ReadLock(Shard->Lock);
+			for (const TPair<FString, FHippocacheEntry*>& Pair : Shard->Index)
+			{
+				const FCachedItem& Item = Pair.Value->Item;
+				if (!Item.HasExpired(Now) && Item.GetScriptStruct())
+				{
+					Visitor(Pair.Value->Key, Item.GetScriptStruct(), Item.GetMemory());
+				}
+			}
+			continue;
+		}
+
+		FHippocacheEpoch::FReadScope EpochScope;
+		const FTable* Table = Shard->Table.load(std::memory_order_acquire);
+		for (int32 Index = 0; Index < Table->Capacity; ++Index)
+		{
+			const FHippocacheEntry* Entry = Table->Slots[Index].load(std::memory_order_acquire);
+			if (!Entry)
+			{
+				continue;
+			}
+
+			const FCachedItem& Item = Entry->Item;
+			const UScriptStruct* Struct = Item.GetScriptStruct();
+			const void* Memory = Item.GetMemory();
+			uint64 Deadline = Item.Deadline;
+			alignas(16) uint8 InlineSnapshot[FCachedItem::InlineCapacity];
+			if (Item.IsInline())
+			{
+				SnapshotInlineItem(*Entry, Struct, Deadline, InlineSnapshot);
+				Memory = InlineSnapshot;
+			}
+
+			if (Struct && !FCachedItem::HasExpired(Deadline, Now))
+			{
+				Visitor(Entry->Key, Struct, Memory);
+			}
+		}
+	}
+}
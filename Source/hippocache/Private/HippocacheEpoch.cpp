@@ -0,0 +1,230 @@
+#include "HippocacheEpoch.h"
+#include "HAL/CriticalSection.h"
+#include "Misc/ScopeLock.h"
+#include <atomic>
+
+namespace HippocacheEpochPrivate
+{
+	/** Slot value meaning "the owning thread is not inside a read scope". */
+	constexpr uint64 InactiveEpoch = 0;
+
+	/** Reclaim opportunistically after this many retirements. */
+	constexpr uint32 ReclaimInterval = 64;
+
+	/** Per-thread reader slot. Slots are recycled when threads exit and never freed. */
+	struct alignas(PLATFORM_CACHE_LINE_SIZE) FReaderSlot
+	{
+		/** Epoch pinned by the owning thread, or InactiveEpoch. */
+		std::atomic<uint64> Epoch { InactiveEpoch };
+
+		/** Whether a live thread owns this slot. */
+		std::atomic<bool> bInUse { false };
+
+		/** Next slot in the global list. Immutable once published. */
+		FReaderSlot* Next = nullptr;
+	};
+
+	/** An object waiting for readers to leave. */
+	struct FRetiredObject
+	{
+		void* Object;
+		FHippocacheEpoch::FDeleter Deleter;
+
+		/** Global epoch at retirement. Readers pinned at or before it may still see Object. */
+		uint64 Epoch;
+	};
+
+	std::atomic<uint64> GlobalEpoch { 1 };
+	std::atomic<FReaderSlot*> SlotListHead { nullptr };
+	std::atomic<uint32> RetireCounter { 0 };
+
+	/** Guards RetiredObjects, which is kept in retirement (and therefore epoch) order. */
+	FCriticalSection RetiredLock;
+	TArray<FRetiredObject> RetiredObjects;
+
+	/**
+	 * Held from taking a batch off RetiredObjects until its last deleter returns, so batches taken by
+	 * different threads never run interleaved and every object is destroyed in retirement order.
+	 */
+	FCriticalSection ReclaimLock;
+
+	/** Set while the calling thread runs deleters. A reclaim started from a deleter would overtake its own batch. */
+	thread_local bool bReclaiming = false;
+
+	/** Destroys every retired object no reader can still reference. Requires ReclaimLock. */
+	int32 ReclaimLocked()
+	{
+		// Anything retired before this point is only reachable by readers whose pins the scan below will see
+		uint64 SafeEpoch = GlobalEpoch.load(std::memory_order_seq_cst);
+		for (FReaderSlot* Slot = SlotListHead.load(std::memory_order_acquire); Slot; Slot = Slot->Next)
+		{
+			const uint64 PinnedEpoch = Slot->Epoch.load(std::memory_order_seq_cst);
+			if (PinnedEpoch != InactiveEpoch)
+			{
+				SafeEpoch = FMath::Min(SafeEpoch, PinnedEpoch);
+			}
+		}
+
+		TArray<FRetiredObject> Ready;
+		{
+			FScopeLock Lock(&RetiredLock);
+			int32 ReadyCount = 0;
+			while (ReadyCount < RetiredObjects.Num() && RetiredObjects[ReadyCount].Epoch < SafeEpoch)
+			{
+				++ReadyCount;
+			}
+			if (ReadyCount > 0)
+			{
+				Ready.Append(RetiredObjects.GetData(), ReadyCount);
+				RetiredObjects.RemoveAt(0, ReadyCount);
+			}
+		}
+
+		// Deleters run outside RetiredLock since they may retire further objects; those wait for a later batch
+		TGuardValue<bool> ReclaimingGuard(bReclaiming, true);
+		for (const FRetiredObject& Retired : Ready)
+		{
+			Retired.Deleter(Retired.Object);
+		}
+		return Ready.Num();
+	}
+
+	FReaderSlot* AcquireSlot()
+	{
+		// Reuse a slot released by an exited thread first
+		for (FReaderSlot* Slot = SlotListHead.load(std::memory_order_acquire); Slot; Slot = Slot->Next)
+		{
+			bool bExpected = false;
+			if (!Slot->bInUse.load(std::memory_order_relaxed) && Slot->bInUse.compare_exchange_strong(bExpected, true, std::memory_order_acquire))
+			{
+				return Slot;
+			}
+		}
+
+		FReaderSlot* NewSlot = new FReaderSlot();
+		NewSlot->bInUse.store(true, std::memory_order_relaxed);
+
+		FReaderSlot* Head = SlotListHead.load(std::memory_order_relaxed);
+		do
+		{
+			NewSlot->Next = Head;
+		}
+		while (!SlotListHead.compare_exchange_weak(Head, NewSlot, std::memory_order_release, std::memory_order_relaxed));
+
+		return NewSlot;
+	}
+
+	/** Reader state of the calling thread. Releases the slot when the thread exits. */
+	struct FThreadState
+	{
+		FReaderSlot* Slot = nullptr;
+		int32 Depth = 0;
+
+		~FThreadState()
+		{
+			if (Slot)
+			{
+				Slot->Epoch.store(InactiveEpoch, std::memory_order_release);
+				Slot->bInUse.store(false, std::memory_order_release);
+			}
+		}
+	};
+
+	thread_local FThreadState ThreadState;
+}
+
+FHippocacheEpoch::FReadScope::FReadScope()
+{
+	using namespace HippocacheEpochPrivate;
+
+	FThreadState& State = ThreadState;
+	if (State.Depth++ == 0)
+	{
+		if (!State.Slot)
+		{
+			State.Slot = AcquireSlot();
+		}
+
+		// The pin must be visible to reclaimers before any shared pointer is loaded
+		State.Slot->Epoch.store(GlobalEpoch.load(std::memory_order_relaxed), std::memory_order_relaxed);
+		std::atomic_thread_fence(std::memory_order_seq_cst);
+	}
+}
+
+FHippocacheEpoch::FReadScope::~FReadScope()
+{
+	using namespace HippocacheEpochPrivate;
+
+	FThreadState& State = ThreadState;
+	if (--State.Depth == 0)
+	{
+		State.Slot->Epoch.store(InactiveEpoch, std::memory_order_release);
+	}
+}
+
+void FHippocacheEpoch::Retire(void* Object, FDeleter Deleter)
+{
+	using namespace HippocacheEpochPrivate;
+
+	check(Object && Deleter);
+	{
+		FScopeLock Lock(&RetiredLock);
+		RetiredObjects.Add({ Object, Deleter, GlobalEpoch.fetch_add(1, std::memory_order_seq_cst) });
+	}
+
+	// Opportunistic: a writer never waits for another thread's batch, nor reclaims from inside a deleter
+	if ((RetireCounter.fetch_add(1, std::memory_order_relaxed) + 1) % ReclaimInterval == 0 && !bReclaiming && ReclaimLock.TryLock())
+	{
+		ReclaimLocked();
+		ReclaimLock.Unlock();
+	}
+}
+
+int32 FHippocacheEpoch::Reclaim()
+{
+	using namespace HippocacheEpochPrivate;
+
+	if (bReclaiming)
+	{
+		return 0;
+	}
+	FScopeLock Lock(&ReclaimLock);
+	return ReclaimLocked();
+}
+
+int32 FHippocacheEpoch::NumPendingRetired()
+{
+	using namespace HippocacheEpochPrivate;
+
+	FScopeLock Lock(&RetiredLock);
+	return RetiredObjects.Num();
+}
+
+void FHippocacheEpoch::Shutdown()
+{
+	using namespace HippocacheEpochPrivate;
+
+	FScopeLock ReclaimScope(&ReclaimLock);
+	TGuardValue<bool> ReclaimingGuard(bReclaiming, true);
+	int32 ReclaimedCount = 0;
+	for (;;)
+	{
+		TArray<FRetiredObject> Ready;
+		{
+			FScopeLock Lock(&RetiredLock);
+			Ready = MoveTemp(RetiredObjects);
+			RetiredObjects.Reset();
+		}
+		if (Ready.Num() == 0)
+		{
+			break;
+		}
+		for (const FRetiredObject& Retired : Ready)
+		{
+			Retired.Deleter(Retired.Object);
+		}
+		ReclaimedCount += Ready.Num();
+	}
+
+	UE_LOG(LogTemp, Log, TEXT("Hippocache: Reclaimed %d retired objects at shutdown"), ReclaimedCount);
+}
@@ -0,0 +1,45 @@
+#include "HippocacheExpiryWorker.h"
+#include "HAL/Event.h"
+#include "HAL/PlatformProcess.h"
+#include "HAL/RunnableThread.h"
+
+FHippocacheExpiryWorker::FHippocacheExpiryWorker(TFunction<void()> InStep, float InIntervalSeconds)
+	: Step(MoveTemp(InStep))
+	, IntervalMs(static_cast<uint32>(FMath::Max(FMath::RoundToInt(InIntervalSeconds * 1000.0f), 1)))
+	, WakeEvent(FPlatformProcess::GetSynchEventFromPool(false))
+{
+	// Below normal, so a long sweep never competes with the game and render threads
+	Thread = FRunnableThread::Create(this, TEXT("HippocacheExpiryWorker"), 0, TPri_BelowNormal);
+}
+
+FHippocacheExpiryWorker::~FHippocacheExpiryWorker()
+{
+	if (Thread)
+	{
+		// Calls Stop and waits for Run to return
+		Thread->Kill(true);
+		delete Thread;
+		Thread = nullptr;
+	}
+	FPlatformProcess::ReturnSynchEventToPool(WakeEvent);
+}
+
+uint32 FHippocacheExpiryWorker::Run()
+{
+	while (!bStopping.load(std::memory_order_acquire))
+	{
+		WakeEvent->Wait(IntervalMs);
+		if (bStopping.load(std::memory_order_acquire))
+		{
+			break;
+		}
+		Step();
+	}
+	return 0;
+}
+
+void FHippocacheExpiryWorker::Stop()
+{
+	bStopping.store(true, std::memory_order_release);
+	WakeEvent->Trigger();
+}
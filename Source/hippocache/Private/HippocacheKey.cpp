@@ -0,0 +1,29 @@
+#include "HippocacheKey.h"
+
+uint64 FHippocacheKey::HashString(const FString& InKey)
+{
+	// FNV-1a over lower-cased characters, so keys that differ only in case hash alike (FString == ignores case)
+	uint64 Result = 14695981039346656037ull;
+	const TCHAR* Chars = *InKey;
+	for (int32 Index = 0; Index < InKey.Len(); ++Index)
+	{
+		Result ^= static_cast<uint64>(FChar::ToLower(Chars[Index]));
+		Result *= 1099511628211ull;
+	}
+
+	// MurmurHash3 finalizer: shard index, probe group and control byte each take different bits, so all must be mixed
+	Result ^= Result >> 33;
+	Result *= 0xff51afd7ed558ccdull;
+	Result ^= Result >> 33;
+	Result *= 0xc4ceb9fe1a85ec53ull;
+	Result ^= Result >> 33;
+	return Result;
+}
+
+void FHippocacheKey::PostSerialize(const FArchive& Ar)
+{
+	if (Ar.IsLoading())
+	{
+		Hash = HashString(Key);
+	}
+}
@@ -0,0 +1,155 @@
+#include "HippocachePropertyValue.h"
+#include "UObject/GCObject.h"
+
+/**
+ * A property duplicated for the values built from it. The duplicate has no owner, so nothing else frees
+ * it, and the structs and enums it points to are reported to the GC for as long as a value uses it.
+ */
+class FHippocachePropertyType final : public FGCObject
+{
+public:
+	explicit FHippocachePropertyType(const FProperty* Source)
+		: Property(CastFieldChecked<FProperty>(FField::Duplicate(Source, FFieldVariant(), Source->GetFName())))
+	{
+	}
+
+	virtual ~FHippocachePropertyType() override
+	{
+		delete Property;
+	}
+
+	// FGCObject implementation
+	virtual void AddReferencedObjects(FReferenceCollector& Collector) override
+	{
+		Property->AddReferencedObjects(Collector);
+	}
+
+	virtual FString GetReferencerName() const override
+	{
+		return TEXT("FHippocachePropertyValue");
+	}
+
+	FProperty* const Property;
+};
+
+FHippocachePropertyValue::FHippocachePropertyValue(const FProperty* InProperty, const void* Source)
+{
+	check(InProperty && Source);
+	Type = MakeShared<FHippocachePropertyType, ESPMode::ThreadSafe>(InProperty);
+	Allocate();
+	Type->Property->CopyCompleteValue(Memory, Source);
+}
+
+FHippocachePropertyValue::FHippocachePropertyValue(const FHippocachePropertyValue& Other)
+{
+	*this = Other;
+}
+
+FHippocachePropertyValue::FHippocachePropertyValue(FHippocachePropertyValue&& Other)
+{
+	MoveFrom(Other);
+}
+
+FHippocachePropertyValue& FHippocachePropertyValue::operator=(const FHippocachePropertyValue& Other)
+{
+	if (this != &Other)
+	{
+		if (!Other.Type)
+		{
+			Reset();
+		}
+		else if (Type && (Type == Other.Type || Type->Property->SameType(Other.Type->Property)))
+		{
+			// Same layout: copy over the existing value and keep its storage
+			Type->Property->CopyCompleteValue(Memory, Other.Memory);
+		}
+		else
+		{
+			// The duplicate is shared rather than duplicated again
+			Reset();
+			Type = Other.Type;
+			Allocate();
+			Type->Property->CopyCompleteValue(Memory, Other.Memory);
+		}
+	}
+	return *this;
+}
+
+FHippocachePropertyValue& FHippocachePropertyValue::operator=(FHippocachePropertyValue&& Other)
+{
+	if (this != &Other)
+	{
+		Reset();
+		MoveFrom(Other);
+	}
+	return *this;
+}
+
+FHippocachePropertyValue::~FHippocachePropertyValue()
+{
+	Reset();
+}
+
+bool FHippocachePropertyValue::IsSameType(const FProperty* OtherProperty) const
+{
+	return Type && OtherProperty && (Type->Property == OtherProperty || Type->Property->SameType(OtherProperty));
+}
+
+void FHippocachePropertyValue::CopyTo(const FProperty* OtherProperty, void* Destination) const
+{
+	check(IsSameType(OtherProperty));
+	OtherProperty->CopyCompleteValue(Destination, Memory);
+}
+
+const FProperty* FHippocachePropertyValue::GetProperty() const
+{
+	return Type ? Type->Property : nullptr;
+}
+
+bool FHippocachePropertyValue::operator==(const FHippocachePropertyValue& Other) const
+{
+	if (!Type || !Other.Type)
+	{
+		return Type == Other.Type;
+	}
+	return IsSameType(Other.Type->Property) && Type->Property->Identical(Memory, Other.Memory);
+}
+
+void FHippocachePropertyValue::Allocate()
+{
+	const FProperty* Property = Type->Property;
+	Memory = Property->GetSize() <= InlineSize && Property->GetMinAlignment() <= 16
+		? static_cast<void*>(&InlineValue)
+		: FMemory::Malloc(Property->GetSize(), Property->GetMinAlignment());
+	Property->InitializeValue(Memory);
+}
+
+void FHippocachePropertyValue::Reset()
+{
+	if (Memory)
+	{
+		Type->Property->DestroyValue(Memory);
+		if (!IsInline())
+		{
+			FMemory::Free(Memory);
+		}
+	}
+	Type.Reset();
+	Memory = nullptr;
+}
+
+void FHippocachePropertyValue::MoveFrom(FHippocachePropertyValue& Other)
+{
+	Type = MoveTemp(Other.Type);
+	if (Other.IsInline())
+	{
+		// Engine containers and strings are bitwise relocatable, the same assumption TArray makes
+		FMemory::Memcpy(&InlineValue, &Other.InlineValue, InlineSize);
+		Memory = &InlineValue;
+	}
+	else
+	{
+		Memory = Other.Memory;
+	}
+	Other.Memory = nullptr;
+}
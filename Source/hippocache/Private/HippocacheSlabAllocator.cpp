@@ -0,0 +1,71 @@
+#include "HippocacheSlabAllocator.h"
+#include "Misc/ScopeLock.h"
+
+FHippocacheSlabAllocator::~FHippocacheSlabAllocator()
+{
+	for (void* Page : Pages)
+	{
+		FMemory::Free(Page);
+	}
+}
+
+void* FHippocacheSlabAllocator::Allocate(int32 Size)
+{
+	check(Size > 0 && Size <= MaxBlockSize);
+	const int32 SizeClass = (Size - 1) / BlockAlignment;
+	const int32 BlockSize = (SizeClass + 1) * BlockAlignment;
+
+	FScopeLock ScopeLock(&Lock);
+	FSizeClass& Class = SizeClasses[SizeClass];
+	++AllocatedBlocks;
+
+	if (FFreeBlock* Block = Class.FreeList)
+	{
+		Class.FreeList = Block->Next;
+		return Block;
+	}
+
+	if (Class.Cursor + BlockSize > Class.End)
+	{
+		// Pages are aligned to their size, so Free can find the header from any block address
+		uint8* Page = static_cast<uint8*>(FMemory::Malloc(PageSize, PageSize));
+		new (Page) FPageHeader{ this, SizeClass };
+		Pages.Add(Page);
+		Class.Cursor = Page + HeaderSize;
+		Class.End = Page + PageSize;
+	}
+
+	void* Block = Class.Cursor;
+	Class.Cursor += BlockSize;
+	return Block;
+}
+
+void FHippocacheSlabAllocator::Free(void* Block)
+{
+	if (!Block)
+	{
+		return;
+	}
+
+	const FPageHeader* Header = reinterpret_cast<const FPageHeader*>(reinterpret_cast<UPTRINT>(Block) & ~static_cast<UPTRINT>(PageSize - 1));
+	FHippocacheSlabAllocator* Owner = Header->Owner;
+
+	FScopeLock ScopeLock(&Owner->Lock);
+	FSizeClass& Class = Owner->SizeClasses[Header->SizeClass];
+	FFreeBlock* FreeBlock = static_cast<FFreeBlock*>(Block);
+	FreeBlock->Next = Class.FreeList;
+	Class.FreeList = FreeBlock;
+	--Owner->AllocatedBlocks;
+}
+
+int32 FHippocacheSlabAllocator::NumPages() const
+{
+	FScopeLock ScopeLock(&Lock);
+	return Pages.Num();
+}
+
+int32 FHippocacheSlabAllocator::NumAllocatedBlocks() const
+{
+	FScopeLock ScopeLock(&Lock);
+	return AllocatedBlocks;
+}
@@ -4,12 +4,47 @@
 #include "Engine/GameInstance.h"
 #include "Engine/Engine.h"
 #include "HippocacheVariantWrapper.h"
+#include "HippocacheEpoch.h"
+#include "HippocacheExpiryWorker.h"
 
-// Macros for read-write lock patterns
-#define HIPPOCACHE_READ_LOCK() FReadScopeLock ReadLock(CacheRWLock)
-#define HIPPOCACHE_WRITE_LOCK() FWriteScopeLock WriteLock(CacheRWLock)
-// Legacy macro for compatibility (uses write lock for safety)
-#define HIPPOCACHE_SCOPED_LOCK() FWriteScopeLock WriteLock(CacheRWLock)
+// Macro for the collection directory lock - only taken when collections are created or destroyed.
+// Data reads and writes lock inside the owning FHippocacheCollection instead.
+#define HIPPOCACHE_DIRECTORY_LOCK() FScopeLock DirectoryLock(&DirectoryWriteLock)
+
+namespace HippocacheSubsystemPrivate
+{
+	/** Upper bound for the configured shard count. */
+	constexpr int32 MaxShardCount = 1024;
+
+	/** Shortest interval the sweep timer runs at, in seconds. */
+	constexpr float MinSweepInterval = 0.01f;
+
+	/**
+	 * Bumped whenever a subsystem is initialized or deinitialized. A resolution cached under an older
+	 * generation may point at a subsystem that has since gone away, so it is not reused.
+	 */
+	std::atomic<uint32> SubsystemGeneration{0};
+
+	/**
+	 * The last context object and world each thread resolved a subsystem for. The weak pointers stop matching
+	 * once their object is destroyed, so a new object allocated at the same address is never mistaken for it.
+	 * A world belongs to a single GameInstance for its whole life, as does any object inside it, so while all
+	 * three are alive and the generation is unchanged they keep yielding the same subsystem.
+	 */
+	struct FResolvedSubsystem
+	{
+		TWeakObjectPtr<const UObject> ContextObject;
+		TWeakObjectPtr<UWorld> World;
+		TWeakObjectPtr<UHippocacheSubsystem> Subsystem;
+		uint32 Generation = 0;
+
+		UHippocacheSubsystem* Find(uint32 CurrentGeneration) const
+		{
+			return Generation == CurrentGeneration && World.IsValid() ? Subsystem.Get() : nullptr;
+		}
+	};
+	thread_local FResolvedSubsystem LastResolvedSubsystem;
+}
 
 
 // FHippocacheClientHandle implementation
@@ -48,6 +83,18 @@ FHippocacheResult UHippocacheSubsystem::Get(const UObject* WorldContextObject, U
 			TEXT("Engine not initialized"));
 	}
 
+	// Fastest path: the same context object as last time skips resolving its world at all
+	HippocacheSubsystemPrivate::FResolvedSubsystem& LastResolved = HippocacheSubsystemPrivate::LastResolvedSubsystem;
+	const uint32 Generation = HippocacheSubsystemPrivate::SubsystemGeneration.load(std::memory_order_acquire);
+	if (LastResolved.ContextObject == WorldContextObject)
+	{
+		if (UHippocacheSubsystem* Subsystem = LastResolved.Find(Generation))
+		{
+			OutSubsystem = Subsystem;
+			return FHippocacheResult::Success();
+		}
+	}
+
 	UWorld* World = GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::LogAndReturnNull);
 	if (!World)
 	{
@@ -56,6 +103,17 @@ FHippocacheResult UHippocacheSubsystem::Get(const UObject* WorldContextObject, U
 			FString::Printf(TEXT("WorldContextObject: %s"), *WorldContextObject->GetClass()->GetName()));
 	}
 
+	// Fast path: the same world as last time skips the GameInstance and subsystem map lookups
+	if (LastResolved.World == World)
+	{
+		if (UHippocacheSubsystem* Subsystem = LastResolved.Find(Generation))
+		{
+			LastResolved.ContextObject = WorldContextObject;
+			OutSubsystem = Subsystem;
+			return FHippocacheResult::Success();
+		}
+	}
+
 	// Get GameInstance from World
 	UGameInstance* GameInstance = World->GetGameInstance();
 	if (!GameInstance)
@@ -74,31 +132,147 @@ FHippocacheResult UHippocacheSubsystem::Get(const UObject* WorldContextObject, U
 			FString::Printf(TEXT("GameInstance: %s"), *GameInstance->GetName()));
 	}
 
+	LastResolved.ContextObject = WorldContextObject;
+	LastResolved.World = World;
+	LastResolved.Subsystem = OutSubsystem;
+	LastResolved.Generation = Generation;
 	return FHippocacheResult::Success();
 }
 
 
+int32 UHippocacheSubsystem::GetShardCount() const
+{
+	return ResolveShardCount(0);
+}
+
+int32 UHippocacheSubsystem::ResolveShardCount(int32 RequestedCount) const
+{
+	const int32 ClampedCount = FMath::Clamp(RequestedCount > 0 ? RequestedCount : ShardCount, 1, HippocacheSubsystemPrivate::MaxShardCount);
+	return static_cast<int32>(FMath::RoundUpToPowerOfTwo(static_cast<uint32>(ClampedCount)));
+}
+
+FHippocacheCollection* UHippocacheSubsystem::FindCollection(FName Collection) const
+{
+	const FHippocacheCollectionDirectory* CurrentDirectory = Directory.load(std::memory_order_acquire);
+	if (!CurrentDirectory)
+	{
+		return nullptr;
+	}
+
+	const TSharedPtr<FHippocacheCollection, ESPMode::ThreadSafe>* Found = CurrentDirectory->Collections.Find(Collection);
+	return Found ? Found->Get() : nullptr;
+}
+
+const TSharedPtr<FHippocacheCollection, ESPMode::ThreadSafe>& UHippocacheSubsystem::FindOrAddCollection(FName Collection)
+{
+	FHippocacheCollectionOptions DefaultOptions;
+	DefaultOptions.IndexType = DefaultIndexType;
+	return FindOrAddCollection(Collection, DefaultOptions);
+}
+
+const TSharedPtr<FHippocacheCollection, ESPMode::ThreadSafe>& UHippocacheSubsystem::FindOrAddCollection(FName Collection, const FHippocacheCollectionOptions& Options, bool* OutCreated)
+{
+	if (OutCreated)
+	{
+		*OutCreated = false;
+	}
+	if (const FHippocacheCollectionDirectory* CurrentDirectory = Directory.load(std::memory_order_acquire))
+	{
+		if (const TSharedPtr<FHippocacheCollection, ESPMode::ThreadSafe>* Existing = CurrentDirectory->Collections.Find(Collection))
+		{
+			return *Existing;
+		}
+	}
+
+	HIPPOCACHE_DIRECTORY_LOCK();
+
+	// Another thread may have created it while we were waiting for the lock
+	FHippocacheCollectionDirectory* CurrentDirectory = Directory.load(std::memory_order_acquire);
+	if (CurrentDirectory)
+	{
+		if (const TSharedPtr<FHippocacheCollection, ESPMode::ThreadSafe>* Found = CurrentDirectory->Collections.Find(Collection))
+		{
+			return *Found;
+		}
+	}
+
+	// Copy-on-write: readers keep walking the old snapshot while the new one is published
+	FHippocacheCollectionDirectory* NewDirectory = new FHippocacheCollectionDirectory();
+	if (CurrentDirectory)
+	{
+		NewDirectory->Collections = CurrentDirectory->Collections;
+	}
+
+	const TSharedPtr<FHippocacheCollection, ESPMode::ThreadSafe>& NewCollection = NewDirectory->Collections.Add(Collection,
+		MakeShared<FHippocacheCollection, ESPMode::ThreadSafe>(Collection, ResolveShardCount(Options.ShardCount), Options.IndexType, Options.ValueAllocator, Options.ValueType));
+
+	Directory.store(NewDirectory, std::memory_order_release);
+	if (CurrentDirectory)
+	{
+		FHippocacheEpoch::Retire(CurrentDirectory);
+	}
+
+	if (OutCreated)
+	{
+		*OutCreated = true;
+	}
+
+	UE_LOG(LogTemp, Verbose, TEXT("HippocacheSubsystem: Created collection '%s' (%s, %s, %d shards)"), *Collection.ToString(),
+		*UEnum::GetValueAsString(Options.IndexType), *UEnum::GetValueAsString(Options.ValueAllocator), NewCollection->GetShardCount());
+	return NewCollection;
+}
+
+FHippocacheResult UHippocacheSubsystem::ResolveHandle(const FHippocacheCollectionHandle& Handle, FHippocacheCollection*& OutCollection)
+{
+	if (!Handle.IsValid())
+	{
+		OutCollection = nullptr;
+		return FHippocacheResult::Error(EHippocacheErrorCode::InvalidCollection, 
+			TEXT("Collection handle is invalid"), 
+			FString::Printf(TEXT("Collection: %s"), *Handle.GetName().ToString()));
+	}
+
+	OutCollection = Handle.CollectionPtr.Get();
+	return FHippocacheResult::Success();
+}
+
 void UHippocacheSubsystem::Initialize(FSubsystemCollectionBase& Collection)
 {
 	Super::Initialize(Collection);
+	HippocacheSubsystemPrivate::SubsystemGeneration.fetch_add(1, std::memory_order_acq_rel);
 
-	// Start periodic cleanup timer with error handling
+	// Start periodic cleanup on a worker thread when configured to, otherwise on the world's timer
 	UWorld* World = GetWorld();
-	if (World)
+	const float SweepInterval = FMath::Max(ExpirySweepInterval, HippocacheSubsystemPrivate::MinSweepInterval);
+	const TCHAR* SweepRunner = nullptr;
+	if (bExpiryWorkerThread && FPlatformProcess::SupportsMultithreading())
+	{
+		ExpiryWorker = new FHippocacheExpiryWorker([this]() { PerformCleanup(); }, SweepInterval);
+		SweepRunner = TEXT("worker thread");
+	}
+	else if (World)
 	{
 		FTimerManager& TimerManager = World->GetTimerManager();
-		TimerManager.SetTimer(CleanupTimerHandle, this, &UHippocacheSubsystem::PerformCleanup, 60.0f, true);
-		
-		UE_LOG(LogTemp, Log, TEXT("HippocacheSubsystem: Cleanup timer started (60 second interval)"));
+		TimerManager.SetTimer(CleanupTimerHandle, this, &UHippocacheSubsystem::PerformCleanup, SweepInterval, true);
+		SweepRunner = TEXT("world timer");
+	}
+
+	if (SweepRunner)
+	{
+		UE_LOG(LogTemp, Log, TEXT("HippocacheSubsystem: Expiration sweep started on the %s (%.2f second interval, %d items / %.2f ms per step, %d shards per collection)"),
+			SweepRunner, SweepInterval, ExpirySweepItemBudget, ExpirySweepTimeBudgetMs, GetShardCount());
 	}
 	else
 	{
-		UE_LOG(LogTemp, Warning, TEXT("HippocacheSubsystem: Failed to start cleanup timer - World is null"));
+		UE_LOG(LogTemp, Warning, TEXT("HippocacheSubsystem: Failed to start cleanup - World is null and bExpiryWorkerThread is off or threads are unavailable"));
 	}
 }
 
 void UHippocacheSubsystem::Deinitialize()
 {
+	// The worker must be gone before the collections it sweeps
+	StopExpiryWorker();
+
 	// Clear cleanup timer with error handling
 	UWorld* World = GetWorld();
 	if (World && CleanupTimerHandle.IsValid())
@@ -110,16 +284,50 @@ void UHippocacheSubsystem::Deinitialize()
 
 	// Clear all data
 	// const int32 ClientCount = ActiveClients.Num();
-	const int32 DataCount = AllClientData.Num();
+	const int32 DataCount = ReleaseDirectory();
 	
 	// ActiveClients.Empty();
-	AllClientData.Empty();
 
 	UE_LOG(LogTemp, Log, TEXT("HippocacheSubsystem: Cleared %d data collections"), DataCount);
 
+	// Drops every thread's cached resolution of this subsystem
+	HippocacheSubsystemPrivate::SubsystemGeneration.fetch_add(1, std::memory_order_acq_rel);
+
 	Super::Deinitialize();
 }
 
+void UHippocacheSubsystem::BeginDestroy()
+{
+	// Subsystems created outside a GameInstance (tests) never see Deinitialize
+	StopExpiryWorker();
+	ReleaseDirectory();
+	HippocacheSubsystemPrivate::SubsystemGeneration.fetch_add(1, std::memory_order_acq_rel);
+
+	Super::BeginDestroy();
+}
+
+int32 UHippocacheSubsystem::ReleaseDirectory()
+{
+	HIPPOCACHE_DIRECTORY_LOCK();
+
+	FHippocacheCollectionDirectory* CurrentDirectory = Directory.exchange(nullptr, std::memory_order_acq_rel);
+	if (!CurrentDirectory)
+	{
+		return 0;
+	}
+
+	// Outstanding handles stop working now; the memory goes once readers leave the snapshot and handles are dropped
+	for (const auto& CollectionPair : CurrentDirectory->Collections)
+	{
+		CollectionPair.Value->MarkDestroyed();
+	}
+
+	// Readers may still be inside the snapshot; it (and any collection only it references) goes once they leave
+	const int32 CollectionCount = CurrentDirectory->Collections.Num();
+	FHippocacheEpoch::Retire(CurrentDirectory);
+	return CollectionCount;
+}
+
 /*
 // Disabled client functions - keeping stub for compilation
 FHippocacheResult UHippocacheSubsystem::CreateOrGetClient(FName Collection, FHippocacheClientHandle& OutClientHandle)
@@ -225,7 +433,119 @@ FHippocacheResult UHippocacheSubsystem::ClearAllClients()
 */
 
 
+FHippocacheResult UHippocacheSubsystem::CreateCollection(FName Collection, const FHippocacheCollectionOptions& Options)
+{
+	if (Collection.IsNone())
+	{
+		return FHippocacheResult::Error(EHippocacheErrorCode::InvalidCollection, TEXT("Collection name cannot be None"), TEXT("Valid collection name required"));
+	}
+
+	FHippocacheEpoch::FReadScope EpochScope;
+	bool bCreated = false;
+	FindOrAddCollection(Collection, Options, &bCreated);
+	if (!bCreated)
+	{
+		return FHippocacheResult::Error(EHippocacheErrorCode::InvalidCollection, TEXT("Collection already exists"), FString::Printf(TEXT("Collection: %s"), *Collection.ToString()));
+	}
+	return FHippocacheResult::Success();
+}
+
+FHippocacheResult UHippocacheSubsystem::ForEachStruct(FName Collection, TFunctionRef<void(const FString& Key, FConstStructView Value)> Visitor) const
+{
+	if (Collection.IsNone())
+	{
+		return FHippocacheResult::Error(EHippocacheErrorCode::InvalidCollection, TEXT("Collection name cannot be None"), TEXT("Valid collection name required"));
+	}
+
+	FHippocacheEpoch::FReadScope EpochScope;
+	const FHippocacheCollection* ClientData = FindCollection(Collection);
+	if (!ClientData)
+	{
+		return FHippocacheResult::Lazy(EHippocacheErrorCode::ItemNotFound, TEXT("Collection not found"), Collection);
+	}
+	ClientData->ForEach([&Visitor](const FString& Key, const UScriptStruct* Struct, const void* Memory)
+	{
+		Visitor(Key, FConstStructView(Struct, static_cast<const uint8*>(Memory)));
+	});
+	return FHippocacheResult::Success();
+}
+
+FHippocacheResult UHippocacheSubsystem::ForEachStruct(const FHippocacheCollectionHandle& Handle, TFunctionRef<void(const FString& Key, FConstStructView Value)> Visitor) const
+{
+	FHippocacheCollection* ClientData = nullptr;
+	FHippocacheResult Result = ResolveHandle(Handle, ClientData);
+	if (Result.IsError())
+	{
+		return Result;
+	}
+	ClientData->ForEach([&Visitor](const FString& Key, const UScriptStruct* Struct, const void* Memory)
+	{
+		Visitor(Key, FConstStructView(Struct, static_cast<const uint8*>(Memory)));
+	});
+	return FHippocacheResult::Success();
+}
+
+FHippocacheResult UHippocacheSubsystem::CreateOrGetCollection(FName Collection, FHippocacheCollectionHandle& OutHandle)
+{
+	OutHandle.Reset();
+	if (Collection.IsNone())
+	{
+		return FHippocacheResult::Error(EHippocacheErrorCode::InvalidCollection, TEXT("Collection name cannot be None"), TEXT("Valid collection name required"));
+	}
+
+	// The snapshot entry is only safe to read inside the scope; the handle's own reference outlives it
+	FHippocacheEpoch::FReadScope EpochScope;
+	OutHandle.CollectionPtr = FindOrAddCollection(Collection);
+	return FHippocacheResult::Success();
+}
+
+FHippocacheResult UHippocacheSubsystem::RemoveCollection(FName Collection)
+{
+	if (Collection.IsNone())
+	{
+		return FHippocacheResult::Error(EHippocacheErrorCode::InvalidCollection, TEXT("Collection name cannot be None"), TEXT("Valid collection name required"));
+	}
+
+	TSharedPtr<FHippocacheCollection, ESPMode::ThreadSafe> RemovedCollection;
+	{
+		HIPPOCACHE_DIRECTORY_LOCK();
+
+		FHippocacheCollectionDirectory* CurrentDirectory = Directory.load(std::memory_order_acquire);
+		const TSharedPtr<FHippocacheCollection, ESPMode::ThreadSafe>* Found = CurrentDirectory ? CurrentDirectory->Collections.Find(Collection) : nullptr;
+		if (!Found)
+		{
+			return FHippocacheResult::Lazy(EHippocacheErrorCode::ItemNotFound, TEXT("Collection not found"), Collection);
+		}
+
+		RemovedCollection = *Found;
+		RemovedCollection->MarkDestroyed();
+
+		// Same copy-on-write publication as creation
+		FHippocacheCollectionDirectory* NewDirectory = new FHippocacheCollectionDirectory();
+		NewDirectory->Collections = CurrentDirectory->Collections;
+		NewDirectory->Collections.Remove(Collection);
+
+		Directory.store(NewDirectory, std::memory_order_release);
+		FHippocacheEpoch::Retire(CurrentDirectory);
+	}
+
+	// Free the items now rather than when the last handle or snapshot lets go of the collection
+	const int32 ClearedCount = RemovedCollection->Clear();
+	UE_LOG(LogTemp, Log, TEXT("HippocacheSubsystem: Removed collection '%s' (%d items)"), *Collection.ToString(), ClearedCount);
+	return FHippocacheResult::Success();
+}
+
 FHippocacheResult UHippocacheSubsystem::Remove(FName Collection, const FString& Key)
+{
+	return RemoveInternal(Collection, Key, FHippocacheKey::HashString(Key));
+}
+
+FHippocacheResult UHippocacheSubsystem::Remove(FName Collection, const FHippocacheKey& Key)
+{
+	return RemoveInternal(Collection, Key.GetKey(), Key.GetHash());
+}
+
+FHippocacheResult UHippocacheSubsystem::RemoveInternal(FName Collection, const FString& Key, uint64 KeyHash)
 {
 	if (Collection.IsNone())
 	{
@@ -236,18 +556,14 @@ FHippocacheResult UHippocacheSubsystem::Remove(FName Collection, const FString&
 		return FHippocacheResult::Error(EHippocacheErrorCode::InvalidKey, TEXT("Key cannot be empty"), FString::Printf(TEXT("Collection: %s"), *Collection.ToString()));
 	}
 	
-	HIPPOCACHE_SCOPED_LOCK();
-	
-	TMap<FString, FCachedItem>* ClientData = AllClientData.Find(Collection);
+	// Keeps the directory snapshot (and the collection it points to) alive while in use
+	FHippocacheEpoch::FReadScope EpochScope;
+	FHippocacheCollection* ClientData = FindCollection(Collection);
 	if (!ClientData)
 	{
-		return FHippocacheResult::Error(EHippocacheErrorCode::ItemNotFound, TEXT("Collection not found"), FString::Printf(TEXT("Collection: %s"), *Collection.ToString()));
+		return FHippocacheResult::Lazy(EHippocacheErrorCode::ItemNotFound, TEXT("Collection not found"), Collection);
 	}
-	if (ClientData->Remove(Key) == 0)
-	{
-		return FHippocacheResult::Error(EHippocacheErrorCode::ItemNotFound, TEXT("Item not found"), FString::Printf(TEXT("Collection: %s, Key: %s"), *Collection.ToString(), *Key));
-	}
-	return FHippocacheResult::Success();
+	return ClientData->Remove(Key, KeyHash);
 }
 
 FHippocacheResult UHippocacheSubsystem::Clear(FName Collection)
@@ -257,15 +573,14 @@ FHippocacheResult UHippocacheSubsystem::Clear(FName Collection)
 		return FHippocacheResult::Error(EHippocacheErrorCode::InvalidCollection, TEXT("Collection name cannot be None"), TEXT("Valid collection name required"));
 	}
 	
-	HIPPOCACHE_SCOPED_LOCK();
-	
-	TMap<FString, FCachedItem>* ClientData = AllClientData.Find(Collection);
+	// Keeps the directory snapshot (and the collection it points to) alive while in use
+	FHippocacheEpoch::FReadScope EpochScope;
+	FHippocacheCollection* ClientData = FindCollection(Collection);
 	if (!ClientData)
 	{
-		return FHippocacheResult::Error(EHippocacheErrorCode::ItemNotFound, TEXT("Collection not found"), FString::Printf(TEXT("Collection: %s"), *Collection.ToString()));
+		return FHippocacheResult::Lazy(EHippocacheErrorCode::ItemNotFound, TEXT("Collection not found"), Collection);
 	}
-	const int32 ClearedCount = ClientData->Num();
-	ClientData->Empty();
+	const int32 ClearedCount = ClientData->Clear();
 	UE_LOG(LogTemp, Log, TEXT("HippocacheSubsystem: Cleared %d items from collection '%s'"), ClearedCount, *Collection.ToString());
 	return FHippocacheResult::Success();
 }
@@ -278,12 +593,12 @@ FHippocacheResult UHippocacheSubsystem::Num(FName Collection, int32& OutCount) c
 		return FHippocacheResult::Error(EHippocacheErrorCode::InvalidCollection, TEXT("Collection name cannot be None"), TEXT("Valid collection name required"));
 	}
 	
-	HIPPOCACHE_READ_LOCK();
-	
-	const TMap<FString, FCachedItem>* ClientData = AllClientData.Find(Collection);
+	// Keeps the directory snapshot (and the collection it points to) alive while in use
+	FHippocacheEpoch::FReadScope EpochScope;
+	const FHippocacheCollection* ClientData = FindCollection(Collection);
 	if (!ClientData)
 	{
-		return FHippocacheResult::Error(EHippocacheErrorCode::ItemNotFound, TEXT("Collection not found"), FString::Printf(TEXT("Collection: %s"), *Collection.ToString()));
+		return FHippocacheResult::Lazy(EHippocacheErrorCode::ItemNotFound, TEXT("Collection not found"), Collection);
 	}
 	OutCount = ClientData->Num();
 	return FHippocacheResult::Success();
@@ -291,6 +606,50 @@ FHippocacheResult UHippocacheSubsystem::Num(FName Collection, int32& OutCount) c
 
 // FInstancedStruct methods
 FHippocacheResult UHippocacheSubsystem::SetStructWithTTL(FName Collection, const FString& Key, const FInstancedStruct& Value, FTimespan TTL)
+{
+	return SetStructInternal(Collection, Key, FHippocacheKey::HashString(Key), Value.GetScriptStruct(), Value.GetMemory(), TTL);
+}
+
+FHippocacheResult UHippocacheSubsystem::SetStructWithTTL(FName Collection, const FHippocacheKey& Key, const FInstancedStruct& Value, FTimespan TTL)
+{
+	return SetStructInternal(Collection, Key.GetKey(), Key.GetHash(), Value.GetScriptStruct(), Value.GetMemory(), TTL);
+}
+
+FHippocacheResult UHippocacheSubsystem::SetStructWithTTL(FName Collection, const FString& Key, FInstancedStruct&& Value, FTimespan TTL)
+{
+	return SetStructInternal(Collection, Key, FHippocacheKey::HashString(Key), MoveTemp(Value), TTL);
+}
+
+FHippocacheResult UHippocacheSubsystem::SetStructWithTTL(FName Collection, const FHippocacheKey& Key, FInstancedStruct&& Value, FTimespan TTL)
+{
+	return SetStructInternal(Collection, Key.GetKey(), Key.GetHash(), MoveTemp(Value), TTL);
+}
+
+FHippocacheResult UHippocacheSubsystem::SetStructInternal(FName Collection, const FString& Key, uint64 KeyHash, const UScriptStruct* Struct, const void* Memory, FTimespan TTL)
+{
+	return WriteInternal(Collection, Key, Struct && Memory, [&](FHippocacheCollection& Target)
+	{
+		return Target.Set(Key, KeyHash, Struct, Memory, TTL);
+	});
+}
+
+FHippocacheResult UHippocacheSubsystem::SetStructInternal(FName Collection, const FString& Key, uint64 KeyHash, FInstancedStruct&& Value, FTimespan TTL)
+{
+	return WriteInternal(Collection, Key, Value.IsValid(), [&](FHippocacheCollection& Target)
+	{
+		return Target.Set(Key, KeyHash, MoveTemp(Value), TTL);
+	});
+}
+
+FHippocacheResult UHippocacheSubsystem::EmplaceStructInternal(FName Collection, const FString& Key, uint64 KeyHash, const UScriptStruct* Struct, TFunctionRef<void(void* Memory)> Construct, FTimespan TTL)
+{
+	return WriteInternal(Collection, Key, Struct != nullptr, [&](FHippocacheCollection& Target)
+	{
+		return Target.Emplace(Key, KeyHash, Struct, Construct, TTL);
+	});
+}
+
+FHippocacheResult UHippocacheSubsystem::WriteInternal(FName Collection, const FString& Key, bool bValidValue, TFunctionRef<FHippocacheResult(FHippocacheCollection& Target)> Write)
 {
 	if (Collection.IsNone())
 	{
@@ -300,16 +659,14 @@ FHippocacheResult UHippocacheSubsystem::SetStructWithTTL(FName Collection, const
 	{
 		return FHippocacheResult::Error(EHippocacheErrorCode::InvalidKey, TEXT("Key cannot be empty"), FString::Printf(TEXT("Collection: %s"), *Collection.ToString()));
 	}
-	if (!Value.IsValid())
+	if (!bValidValue)
 	{
 		return FHippocacheResult::Error(EHippocacheErrorCode::InvalidValue, TEXT("Struct value is invalid"), FString::Printf(TEXT("Collection: %s, Key: %s"), *Collection.ToString(), *Key));
 	}
 	
-	HIPPOCACHE_SCOPED_LOCK();
-	
-	TMap<FString, FCachedItem>& ClientData = GetClientData(Collection);
-	ClientData.Add(Key, FCachedItem(Value, TTL));
-	return FHippocacheResult::Success();
+	// Keeps the directory snapshot (and the collection it points to) alive while in use
+	FHippocacheEpoch::FReadScope EpochScope;
+	return Write(*FindOrAddCollection(Collection));
 }
 
 FHippocacheResult UHippocacheSubsystem::SetStruct(FName Collection, const FString& Key, const FInstancedStruct& Value)
@@ -317,7 +674,62 @@ FHippocacheResult UHippocacheSubsystem::SetStruct(FName Collection, const FStrin
 	return SetStructWithTTL(Collection, Key, Value, FTimespan::Zero());
 }
 
+FHippocacheResult UHippocacheSubsystem::SetStruct(FName Collection, const FHippocacheKey& Key, const FInstancedStruct& Value)
+{
+	return SetStructWithTTL(Collection, Key, Value, FTimespan::Zero());
+}
+
+FHippocacheResult UHippocacheSubsystem::SetStruct(FName Collection, const FString& Key, FInstancedStruct&& Value)
+{
+	return SetStructWithTTL(Collection, Key, MoveTemp(Value), FTimespan::Zero());
+}
+
+FHippocacheResult UHippocacheSubsystem::SetStruct(FName Collection, const FHippocacheKey& Key, FInstancedStruct&& Value)
+{
+	return SetStructWithTTL(Collection, Key, MoveTemp(Value), FTimespan::Zero());
+}
+
 FHippocacheResult UHippocacheSubsystem::GetStruct(FName Collection, const FString& Key, FInstancedStruct& OutValue)
+{
+	return GetStructInternal(Collection, Key, FHippocacheKey::HashString(Key), OutValue);
+}
+
+FHippocacheResult UHippocacheSubsystem::GetStruct(FName Collection, const FHippocacheKey& Key, FInstancedStruct& OutValue)
+{
+	return GetStructInternal(Collection, Key.GetKey(), Key.GetHash(), OutValue);
+}
+
+FHippocacheResult UHippocacheSubsystem::SetStructWithTTL(FName Collection, const FString& Key, const UScriptStruct* Struct, const void* Memory, FTimespan TTL)
+{
+	return SetStructInternal(Collection, Key, FHippocacheKey::HashString(Key), Struct, Memory, TTL);
+}
+
+FHippocacheResult UHippocacheSubsystem::SetStructWithTTL(FName Collection, const FHippocacheKey& Key, const UScriptStruct* Struct, const void* Memory, FTimespan TTL)
+{
+	return SetStructInternal(Collection, Key.GetKey(), Key.GetHash(), Struct, Memory, TTL);
+}
+
+FHippocacheResult UHippocacheSubsystem::SetStruct(FName Collection, const FString& Key, const UScriptStruct* Struct, const void* Memory)
+{
+	return SetStructWithTTL(Collection, Key, Struct, Memory, FTimespan::Zero());
+}
+
+FHippocacheResult UHippocacheSubsystem::SetStruct(FName Collection, const FHippocacheKey& Key, const UScriptStruct* Struct, const void* Memory)
+{
+	return SetStructWithTTL(Collection, Key, Struct, Memory, FTimespan::Zero());
+}
+
+FHippocacheResult UHippocacheSubsystem::GetStruct(FName Collection, const FString& Key, const UScriptStruct* Struct, void* OutMemory)
+{
+	return GetStructInternal(Collection, Key, FHippocacheKey::HashString(Key), Struct, OutMemory);
+}
+
+FHippocacheResult UHippocacheSubsystem::GetStruct(FName Collection, const FHippocacheKey& Key, const UScriptStruct* Struct, void* OutMemory)
+{
+	return GetStructInternal(Collection, Key.GetKey(), Key.GetHash(), Struct, OutMemory);
+}
+
+FHippocacheResult UHippocacheSubsystem::GetStructInternal(FName Collection, const FString& Key, uint64 KeyHash, FInstancedStruct& OutValue)
 {
 	if (Collection.IsNone())
 	{
@@ -328,55 +740,333 @@ FHippocacheResult UHippocacheSubsystem::GetStruct(FName Collection, const FStrin
 		return FHippocacheResult::Error(EHippocacheErrorCode::InvalidKey, TEXT("Key cannot be empty"), FString::Printf(TEXT("Collection: %s"), *Collection.ToString()));
 	}
 	
-	HIPPOCACHE_READ_LOCK();
-	
-	const TMap<FString, FCachedItem>* ClientDataPtr = AllClientData.Find(Collection);
-	if (!ClientDataPtr)
+	// Keeps the directory snapshot (and the collection it points to) alive while in use
+	FHippocacheEpoch::FReadScope EpochScope;
+	const FHippocacheCollection* ClientData = FindCollection(Collection);
+	if (!ClientData)
 	{
-		return FHippocacheResult::Error(EHippocacheErrorCode::ItemNotFound, TEXT("Collection not found"), FString::Printf(TEXT("Collection: %s"), *Collection.ToString()));
+		return FHippocacheResult::Lazy(EHippocacheErrorCode::ItemNotFound, TEXT("Collection not found"), Collection);
 	}
-	const TMap<FString, FCachedItem>& ClientData = *ClientDataPtr;
-	const FCachedItem* FoundItem = ClientData.Find(Key);
-	if (!FoundItem)
+	return ClientData->Get(Key, KeyHash, OutValue);
+}
+
+FHippocacheResult UHippocacheSubsystem::GetStructInternal(FName Collection, const FString& Key, uint64 KeyHash, const UScriptStruct* Struct, void* OutMemory)
+{
+	if (Collection.IsNone())
 	{
-		return FHippocacheResult::Error(EHippocacheErrorCode::ItemNotFound, TEXT("Item not found"), FString::Printf(TEXT("Collection: %s, Key: %s"), *Collection.ToString(), *Key));
+		return FHippocacheResult::Error(EHippocacheErrorCode::InvalidCollection, TEXT("Collection name cannot be None"), TEXT("Valid collection name required"));
 	}
-	
-	// Check expiration but don't remove - let cleanup process handle expired items
-	if (FoundItem->HasExpired())
+	if (Key.IsEmpty())
 	{
-		return FHippocacheResult::Error(EHippocacheErrorCode::ItemExpired, TEXT("Item has expired"), FString::Printf(TEXT("Collection: %s, Key: %s"), *Collection.ToString(), *Key));
+		return FHippocacheResult::Error(EHippocacheErrorCode::InvalidKey, TEXT("Key cannot be empty"), FString::Printf(TEXT("Collection: %s"), *Collection.ToString()));
 	}
-	
-	if (!FoundItem->Value.IsValid())
+	if (!Struct || !OutMemory)
 	{
-		return FHippocacheResult::Error(EHippocacheErrorCode::TypeMismatch, TEXT("Type mismatch - expected Struct"), FString::Printf(TEXT("Collection: %s, Key: %s"), *Collection.ToString(), *Key));
+		return FHippocacheResult::Error(EHippocacheErrorCode::InvalidValue, TEXT("Struct type and destination memory are required"), FString::Printf(TEXT("Collection: %s, Key: %s"), *Collection.ToString(), *Key));
 	}
-	
-	OutValue = FoundItem->Value;
-	
-	// Update access time for LRU tracking (future use) - disabled for performance
-	// FoundItem->UpdateAccessTime();
-	
+
+	FHippocacheEpoch::FReadScope EpochScope;
+	const FHippocacheCollection* ClientData = FindCollection(Collection);
+	if (!ClientData)
+	{
+		return FHippocacheResult::Lazy(EHippocacheErrorCode::ItemNotFound, TEXT("Collection not found"), Collection);
+	}
+	return ClientData->Get(Key, KeyHash, Struct, OutMemory);
+}
+
+FHippocacheResult UHippocacheSubsystem::ReadStruct(FName Collection, const FString& Key, TFunctionRef<void(FConstStructView Value)> Visitor)
+{
+	return ReadStructInternal(Collection, Key, FHippocacheKey::HashString(Key), Visitor);
+}
+
+FHippocacheResult UHippocacheSubsystem::ReadStruct(FName Collection, const FHippocacheKey& Key, TFunctionRef<void(FConstStructView Value)> Visitor)
+{
+	return ReadStructInternal(Collection, Key.GetKey(), Key.GetHash(), Visitor);
+}
+
+FHippocacheResult UHippocacheSubsystem::ReadStructInternal(FName Collection, const FString& Key, uint64 KeyHash, TFunctionRef<void(FConstStructView Value)> Visitor)
+{
+	if (Collection.IsNone())
+	{
+		return FHippocacheResult::Error(EHippocacheErrorCode::InvalidCollection, TEXT("Collection name cannot be None"), TEXT("Valid collection name required"));
+	}
+	if (Key.IsEmpty())
+	{
+		return FHippocacheResult::Error(EHippocacheErrorCode::InvalidKey, TEXT("Key cannot be empty"), FString::Printf(TEXT("Collection: %s"), *Collection.ToString()));
+	}
+
+	FHippocacheEpoch::FReadScope EpochScope;
+	const FHippocacheCollection* ClientData = FindCollection(Collection);
+	if (!ClientData)
+	{
+		return FHippocacheResult::Lazy(EHippocacheErrorCode::ItemNotFound, TEXT("Collection not found"), Collection);
+	}
+	return ClientData->Read(Key, KeyHash, [&Visitor](const UScriptStruct* Struct, const void* Memory)
+	{
+		Visitor(FConstStructView(Struct, static_cast<const uint8*>(Memory)));
+	});
+}
+
+FHippocacheResult UHippocacheSubsystem::UpdateStruct(FName Collection, const FString& Key, TFunctionRef<void(FStructView Value)> Mutator)
+{
+	return UpdateStructInternal(Collection, Key, FHippocacheKey::HashString(Key), nullptr, Mutator);
+}
+
+FHippocacheResult UHippocacheSubsystem::UpdateStruct(FName Collection, const FHippocacheKey& Key, TFunctionRef<void(FStructView Value)> Mutator)
+{
+	return UpdateStructInternal(Collection, Key.GetKey(), Key.GetHash(), nullptr, Mutator);
+}
+
+FHippocacheResult UHippocacheSubsystem::UpdateStructInternal(FName Collection, const FString& Key, uint64 KeyHash, const UScriptStruct* ExpectedStruct, TFunctionRef<void(FStructView Value)> Mutator)
+{
+	if (Collection.IsNone())
+	{
+		return FHippocacheResult::Error(EHippocacheErrorCode::InvalidCollection, TEXT("Collection name cannot be None"), TEXT("Valid collection name required"));
+	}
+	if (Key.IsEmpty())
+	{
+		return FHippocacheResult::Error(EHippocacheErrorCode::InvalidKey, TEXT("Key cannot be empty"), FString::Printf(TEXT("Collection: %s"), *Collection.ToString()));
+	}
+
+	FHippocacheEpoch::FReadScope EpochScope;
+	FHippocacheCollection* ClientData = FindCollection(Collection);
+	if (!ClientData)
+	{
+		return FHippocacheResult::Lazy(EHippocacheErrorCode::ItemNotFound, TEXT("Collection not found"), Collection);
+	}
+	return ClientData->Update(Key, KeyHash, ExpectedStruct, [&Mutator](const UScriptStruct* Struct, void* Memory)
+	{
+		Mutator(FStructView(Struct, static_cast<uint8*>(Memory)));
+	});
+}
+
+FHippocacheResult UHippocacheSubsystem::UpdateInlineInternal(FName Collection, const FString& Key, uint64 KeyHash, const UScriptStruct* Struct, TFunctionRef<bool(void* Memory, bool bFound)> Op)
+{
+	return WriteInternal(Collection, Key, Struct != nullptr, [&](FHippocacheCollection& Target)
+	{
+		return Target.UpdateInline(Key, KeyHash, Struct, Op);
+	});
+}
+
+// Collection handle methods. The handle's reference keeps the collection alive, so no directory lookup or epoch scope is needed here.
+FHippocacheResult UHippocacheSubsystem::SetStructWithTTL(const FHippocacheCollectionHandle& Handle, const FString& Key, const FInstancedStruct& Value, FTimespan TTL)
+{
+	return SetStructInternal(Handle, Key, FHippocacheKey::HashString(Key), Value.GetScriptStruct(), Value.GetMemory(), TTL);
+}
+
+FHippocacheResult UHippocacheSubsystem::SetStructWithTTL(const FHippocacheCollectionHandle& Handle, const FHippocacheKey& Key, const FInstancedStruct& Value, FTimespan TTL)
+{
+	return SetStructInternal(Handle, Key.GetKey(), Key.GetHash(), Value.GetScriptStruct(), Value.GetMemory(), TTL);
+}
+
+FHippocacheResult UHippocacheSubsystem::SetStruct(const FHippocacheCollectionHandle& Handle, const FString& Key, const FInstancedStruct& Value)
+{
+	return SetStructWithTTL(Handle, Key, Value, FTimespan::Zero());
+}
+
+FHippocacheResult UHippocacheSubsystem::SetStruct(const FHippocacheCollectionHandle& Handle, const FHippocacheKey& Key, const FInstancedStruct& Value)
+{
+	return SetStructWithTTL(Handle, Key, Value, FTimespan::Zero());
+}
+
+FHippocacheResult UHippocacheSubsystem::SetStructWithTTL(const FHippocacheCollectionHandle& Handle, const FString& Key, FInstancedStruct&& Value, FTimespan TTL)
+{
+	return SetStructInternal(Handle, Key, FHippocacheKey::HashString(Key), MoveTemp(Value), TTL);
+}
+
+FHippocacheResult UHippocacheSubsystem::SetStructWithTTL(const FHippocacheCollectionHandle& Handle, const FHippocacheKey& Key, FInstancedStruct&& Value, FTimespan TTL)
+{
+	return SetStructInternal(Handle, Key.GetKey(), Key.GetHash(), MoveTemp(Value), TTL);
+}
+
+FHippocacheResult UHippocacheSubsystem::SetStruct(const FHippocacheCollectionHandle& Handle, const FString& Key, FInstancedStruct&& Value)
+{
+	return SetStructWithTTL(Handle, Key, MoveTemp(Value), FTimespan::Zero());
+}
+
+FHippocacheResult UHippocacheSubsystem::SetStruct(const FHippocacheCollectionHandle& Handle, const FHippocacheKey& Key, FInstancedStruct&& Value)
+{
+	return SetStructWithTTL(Handle, Key, MoveTemp(Value), FTimespan::Zero());
+}
+
+FHippocacheResult UHippocacheSubsystem::GetStruct(const FHippocacheCollectionHandle& Handle, const FString& Key, FInstancedStruct& OutValue) const
+{
+	return GetStructInternal(Handle, Key, FHippocacheKey::HashString(Key), OutValue);
+}
+
+FHippocacheResult UHippocacheSubsystem::GetStruct(const FHippocacheCollectionHandle& Handle, const FHippocacheKey& Key, FInstancedStruct& OutValue) const
+{
+	return GetStructInternal(Handle, Key.GetKey(), Key.GetHash(), OutValue);
+}
+
+FHippocacheResult UHippocacheSubsystem::ReadStruct(const FHippocacheCollectionHandle& Handle, const FString& Key, TFunctionRef<void(FConstStructView Value)> Visitor) const
+{
+	return ReadStructInternal(Handle, Key, FHippocacheKey::HashString(Key), Visitor);
+}
+
+FHippocacheResult UHippocacheSubsystem::ReadStruct(const FHippocacheCollectionHandle& Handle, const FHippocacheKey& Key, TFunctionRef<void(FConstStructView Value)> Visitor) const
+{
+	return ReadStructInternal(Handle, Key.GetKey(), Key.GetHash(), Visitor);
+}
+
+FHippocacheResult UHippocacheSubsystem::UpdateStruct(const FHippocacheCollectionHandle& Handle, const FString& Key, TFunctionRef<void(FStructView Value)> Mutator)
+{
+	return UpdateStructInternal(Handle, Key, FHippocacheKey::HashString(Key), nullptr, Mutator);
+}
+
+FHippocacheResult UHippocacheSubsystem::UpdateStruct(const FHippocacheCollectionHandle& Handle, const FHippocacheKey& Key, TFunctionRef<void(FStructView Value)> Mutator)
+{
+	return UpdateStructInternal(Handle, Key.GetKey(), Key.GetHash(), nullptr, Mutator);
+}
+
+FHippocacheResult UHippocacheSubsystem::Remove(const FHippocacheCollectionHandle& Handle, const FString& Key)
+{
+	return RemoveInternal(Handle, Key, FHippocacheKey::HashString(Key));
+}
+
+FHippocacheResult UHippocacheSubsystem::Remove(const FHippocacheCollectionHandle& Handle, const FHippocacheKey& Key)
+{
+	return RemoveInternal(Handle, Key.GetKey(), Key.GetHash());
+}
+
+FHippocacheResult UHippocacheSubsystem::Clear(const FHippocacheCollectionHandle& Handle)
+{
+	FHippocacheCollection* ClientData = nullptr;
+	FHippocacheResult Result = ResolveHandle(Handle, ClientData);
+	if (Result.IsError())
+	{
+		return Result;
+	}
+	const int32 ClearedCount = ClientData->Clear();
+	UE_LOG(LogTemp, Log, TEXT("HippocacheSubsystem: Cleared %d items from collection '%s'"), ClearedCount, *ClientData->GetName().ToString());
 	return FHippocacheResult::Success();
 }
 
-void UHippocacheSubsystem::PerformCleanup()
+FHippocacheResult UHippocacheSubsystem::Num(const FHippocacheCollectionHandle& Handle, int32& OutCount) const
 {
-	HIPPOCACHE_SCOPED_LOCK();
-	
-	// Clean up expired items in all collections
-	for (auto& CollectionPair : AllClientData)
+	OutCount = 0;
+	FHippocacheCollection* ClientData = nullptr;
+	FHippocacheResult Result = ResolveHandle(Handle, ClientData);
+	if (Result.IsError())
 	{
-		TMap<FString, FCachedItem>& ClientData = CollectionPair.Value;
-		for (auto ItemIt = ClientData.CreateIterator(); ItemIt; ++ItemIt)
-		{
-			if (ItemIt->Value.HasExpired())
-			{
-				ItemIt.RemoveCurrent();
-			}
-		}
+		return Result;
+	}
+	OutCount = ClientData->Num();
+	return FHippocacheResult::Success();
+}
+
+FHippocacheResult UHippocacheSubsystem::SetStructInternal(const FHippocacheCollectionHandle& Handle, const FString& Key, uint64 KeyHash, const UScriptStruct* Struct, const void* Memory, FTimespan TTL)
+{
+	return WriteInternal(Handle, Key, Struct && Memory, [&](FHippocacheCollection& Target)
+	{
+		return Target.Set(Key, KeyHash, Struct, Memory, TTL);
+	});
+}
+
+FHippocacheResult UHippocacheSubsystem::SetStructInternal(const FHippocacheCollectionHandle& Handle, const FString& Key, uint64 KeyHash, FInstancedStruct&& Value, FTimespan TTL)
+{
+	return WriteInternal(Handle, Key, Value.IsValid(), [&](FHippocacheCollection& Target)
+	{
+		return Target.Set(Key, KeyHash, MoveTemp(Value), TTL);
+	});
+}
+
+FHippocacheResult UHippocacheSubsystem::WriteInternal(const FHippocacheCollectionHandle& Handle, const FString& Key, bool bValidValue, TFunctionRef<FHippocacheResult(FHippocacheCollection& Target)> Write)
+{
+	FHippocacheCollection* ClientData = nullptr;
+	FHippocacheResult Result = ResolveHandle(Handle, ClientData);
+	if (Result.IsError())
+	{
+		return Result;
+	}
+	if (Key.IsEmpty())
+	{
+		return FHippocacheResult::Error(EHippocacheErrorCode::InvalidKey, TEXT("Key cannot be empty"), FString::Printf(TEXT("Collection: %s"), *ClientData->GetName().ToString()));
+	}
+	if (!bValidValue)
+	{
+		return FHippocacheResult::Error(EHippocacheErrorCode::InvalidValue, TEXT("Struct value is invalid"), FString::Printf(TEXT("Collection: %s, Key: %s"), *ClientData->GetName().ToString(), *Key));
+	}
+	return Write(*ClientData);
+}
+
+FHippocacheResult UHippocacheSubsystem::GetStructInternal(const FHippocacheCollectionHandle& Handle, const FString& Key, uint64 KeyHash, FInstancedStruct& OutValue) const
+{
+	FHippocacheCollection* ClientData = nullptr;
+	FHippocacheResult Result = ResolveHandle(Handle, ClientData);
+	if (Result.IsError())
+	{
+		return Result;
+	}
+	if (Key.IsEmpty())
+	{
+		return FHippocacheResult::Error(EHippocacheErrorCode::InvalidKey, TEXT("Key cannot be empty"), FString::Printf(TEXT("Collection: %s"), *ClientData->GetName().ToString()));
+	}
+	return ClientData->Get(Key, KeyHash, OutValue);
+}
+
+FHippocacheResult UHippocacheSubsystem::ReadStructInternal(const FHippocacheCollectionHandle& Handle, const FString& Key, uint64 KeyHash, TFunctionRef<void(FConstStructView Value)> Visitor) const
+{
+	FHippocacheCollection* ClientData = nullptr;
+	FHippocacheResult Result = ResolveHandle(Handle, ClientData);
+	if (Result.IsError())
+	{
+		return Result;
 	}
+	if (Key.IsEmpty())
+	{
+		return FHippocacheResult::Error(EHippocacheErrorCode::InvalidKey, TEXT("Key cannot be empty"), FString::Printf(TEXT("Collection: %s"), *ClientData->GetName().ToString()));
+	}
+	return ClientData->Read(Key, KeyHash, [&Visitor](const UScriptStruct* Struct, const void* Memory)
+	{
+		Visitor(FConstStructView(Struct, static_cast<const uint8*>(Memory)));
+	});
+}
+
+FHippocacheResult UHippocacheSubsystem::UpdateStructInternal(const FHippocacheCollectionHandle& Handle, const FString& Key, uint64 KeyHash, const UScriptStruct* ExpectedStruct, TFunctionRef<void(FStructView Value)> Mutator)
+{
+	FHippocacheCollection* ClientData = nullptr;
+	FHippocacheResult Result = ResolveHandle(Handle, ClientData);
+	if (Result.IsError())
+	{
+		return Result;
+	}
+	if (Key.IsEmpty())
+	{
+		return FHippocacheResult::Error(EHippocacheErrorCode::InvalidKey, TEXT("Key cannot be empty"), FString::Printf(TEXT("Collection: %s"), *ClientData->GetName().ToString()));
+	}
+	return ClientData->Update(Key, KeyHash, ExpectedStruct, [&Mutator](const UScriptStruct* Struct, void* Memory)
+	{
+		Mutator(FStructView(Struct, static_cast<uint8*>(Memory)));
+	});
+}
+
+FHippocacheResult UHippocacheSubsystem::UpdateInlineInternal(const FHippocacheCollectionHandle& Handle, const FString& Key, uint64 KeyHash, const UScriptStruct* Struct, TFunctionRef<bool(void* Memory, bool bFound)> Op)
+{
+	return WriteInternal(Handle, Key, Struct != nullptr, [&](FHippocacheCollection& Target)
+	{
+		return Target.UpdateInline(Key, KeyHash, Struct, Op);
+	});
+}
+
+FHippocacheResult UHippocacheSubsystem::RemoveInternal(const FHippocacheCollectionHandle& Handle, const FString& Key, uint64 KeyHash)
+{
+	FHippocacheCollection* ClientData = nullptr;
+	FHippocacheResult Result = ResolveHandle(Handle, ClientData);
+	if (Result.IsError())
+	{
+		return Result;
+	}
+	if (Key.IsEmpty())
+	{
+		return FHippocacheResult::Error(EHippocacheErrorCode::InvalidKey, TEXT("Key cannot be empty"), FString::Printf(TEXT("Collection: %s"), *ClientData->GetName().ToString()));
+	}
+	return ClientData->Remove(Key, KeyHash);
+}
+
+void UHippocacheSubsystem::PerformCleanup()
+{
+	SweepExpired(ExpirySweepItemBudget, ExpirySweepTimeBudgetMs / 1000.0);
 	
 	/*
 	// Original implementation using ActiveClients - disabled
@@ -408,20 +1098,75 @@ void UHippocacheSubsystem::PerformCleanup()
 	*/
 }
 
-TMap<FString, FCachedItem>& UHippocacheSubsystem::GetClientData(FName Collection)
+FHippocacheSweepStats UHippocacheSubsystem::SweepExpired(int32 MaxItems, double TimeBudgetSeconds)
 {
-	return AllClientData.FindOrAdd(Collection);
+	FHippocacheSweepStats Stats;
+	if (bSweepRunning.exchange(true, std::memory_order_acquire))
+	{
+		return Stats;
+	}
+
+	const double StartTime = FPlatformTime::Seconds();
+	FHippocacheSweepBudget Budget;
+	Budget.ItemsLeft = MaxItems;
+	Budget.EndTime = StartTime + TimeBudgetSeconds;
+	Budget.MaxLockSeconds = ExpirySweepLockBudgetMs / 1000.0;
+
+	{
+		FHippocacheEpoch::FReadScope EpochScope;
+		const FHippocacheCollectionDirectory* CurrentDirectory = Directory.load(std::memory_order_acquire);
+		if (CurrentDirectory && CurrentDirectory->Collections.Num() > 0)
+		{
+			TArray<FHippocacheCollection*, TInlineAllocator<32>> Collections;
+			int32 StartIndex = 0;
+			for (const auto& CollectionPair : CurrentDirectory->Collections)
+			{
+				if (CollectionPair.Key == SweepCollection)
+				{
+					StartIndex = Collections.Num();
+				}
+				Collections.Add(CollectionPair.Value.Get());
+			}
+
+			// Each collection is visited at most once per step, even if the budget would stretch further
+			for (int32 Visited = 0; Visited < Collections.Num(); ++Visited)
+			{
+				const int32 Index = (StartIndex + Visited) % Collections.Num();
+				SweepCollection = Collections[Index]->GetName();
+				if (!Collections[Index]->SweepExpired(Budget, Stats))
+				{
+					break;
+				}
+				++Stats.CollectionsCompleted;
+				SweepCollection = Collections[(Index + 1) % Collections.Num()]->GetName();
+			}
+		}
+	}
+
+	// Free whatever the sweep (and writers since the last step) retired
+	FHippocacheEpoch::Reclaim();
+
+	Stats.DurationSeconds = FPlatformTime::Seconds() - StartTime;
+	{
+		FScopeLock StatsLock(&SweepStatsLock);
+		LastSweepStats = Stats;
+	}
+	bSweepRunning.store(false, std::memory_order_release);
+	return Stats;
+}
+
+FHippocacheSweepStats UHippocacheSubsystem::GetLastSweepStats() const
+{
+	FScopeLock StatsLock(&SweepStatsLock);
+	return LastSweepStats;
 }
 
-const TMap<FString, FCachedItem>& UHippocacheSubsystem::GetClientData(FName Collection) const
+void UHippocacheSubsystem::StopExpiryWorker()
 {
-	const TMap<FString, FCachedItem>* FoundData = AllClientData.Find(Collection);
-	if (FoundData)
+	if (ExpiryWorker)
 	{
-		return *FoundData;
+		delete ExpiryWorker;
+		ExpiryWorker = nullptr;
+		UE_LOG(LogTemp, Log, TEXT("HippocacheSubsystem: Expiry worker stopped"));
 	}
-	// Return an empty static map if not found (for const correctness)
-	static const TMap<FString, FCachedItem> EmptyMap;
-	return EmptyMap;
 }
-
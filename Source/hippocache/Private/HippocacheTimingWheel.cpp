@@ -0,0 +1,91 @@
+#include "HippocacheTimingWheel.h"
+
+FHippocacheTimingWheel::FHippocacheTimingWheel(uint64 Now)
+	: TickCycles(FMath::Max<uint64>(static_cast<uint64>(TickSeconds / FPlatformTime::GetSecondsPerCycle64()), 1))
+	, CurrentTick(ToTick(Now))
+{
+}
+
+void FHippocacheTimingWheel::Schedule(FHippocacheExpiryRecord&& Record)
+{
+	Insert(MoveTemp(Record));
+	++NumRecords;
+}
+
+bool FHippocacheTimingWheel::PopDue(uint64 Now, FHippocacheExpiryRecord& OutRecord)
+{
+	const uint64 NowTick = ToTick(Now);
+	for (;;)
+	{
+		if (DueIndex < Due.Num())
+		{
+			OutRecord = MoveTemp(Due[DueIndex++]);
+			--NumRecords;
+			return true;
+		}
+		Due.Reset();
+		DueIndex = 0;
+
+		if (CurrentTick > NowTick)
+		{
+			return false;
+		}
+
+		// Records scheduled for this tick while it is popped land in the slot again and are picked up next
+		TArray<FHippocacheExpiryRecord>& Slot = Slots[0][CurrentTick & (NumSlots - 1)];
+		if (Slot.Num() > 0)
+		{
+			LevelCounts[0] -= Slot.Num();
+			Swap(Due, Slot);
+			continue;
+		}
+
+		// Empty levels have nothing to pop or cascade, so go straight to the next slot boundary of the lowest non-empty one
+		uint64 Step = 1;
+		for (int32 Level = 0; Level < NumLevels - 1 && LevelCounts[Level] == 0; ++Level)
+		{
+			Step <<= SlotBits;
+		}
+		CurrentTick = FMath::Min((CurrentTick / Step + 1) * Step, NowTick + 1);
+		Cascade();
+	}
+}
+
+void FHippocacheTimingWheel::Insert(FHippocacheExpiryRecord&& Record)
+{
+	// Due in the first tick that starts after the expiry, so popping never runs ahead of it
+	const uint64 Tick = FMath::Max(ToTick(Record.Deadline) + 1, CurrentTick);
+	for (int32 Level = 0; Level < NumLevels; ++Level)
+	{
+		const int32 Shift = Level * SlotBits;
+		if ((Tick >> Shift) - (CurrentTick >> Shift) < NumSlots)
+		{
+			Slots[Level][(Tick >> Shift) & (NumSlots - 1)].Add(MoveTemp(Record));
+			++LevelCounts[Level];
+			return;
+		}
+	}
+
+	// Beyond the top level: wait in its farthest slot and be placed again when that slot cascades
+	const int32 TopShift = (NumLevels - 1) * SlotBits;
+	Slots[NumLevels - 1][((CurrentTick >> TopShift) + NumSlots - 1) & (NumSlots - 1)].Add(MoveTemp(Record));
+	++LevelCounts[NumLevels - 1];
+}
+
+void FHippocacheTimingWheel::Cascade()
+{
+	// Upper levels first, so records they move into a slot that is also being entered keep going down
+	for (int32 Level = NumLevels - 1; Level > 0; --Level)
+	{
+		const int32 Shift = Level * SlotBits;
+		if ((CurrentTick & ((uint64(1) << Shift) - 1)) == 0)
+		{
+			TArray<FHippocacheExpiryRecord> Records = MoveTemp(Slots[Level][(CurrentTick >> Shift) & (NumSlots - 1)]);
+			LevelCounts[Level] -= Records.Num();
+			for (FHippocacheExpiryRecord& Record : Records)
+			{
+				Insert(MoveTemp(Record));
+			}
+		}
+	}
+}
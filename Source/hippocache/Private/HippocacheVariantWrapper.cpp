@@ -46,13 +46,6 @@ T FVariantWrapper::GetValue() const
     return Variant.GetValue<T>();
 }
 
-template<typename T>
-bool FVariantWrapper::IsType() const
-{
-    FVariant TestVariant(T{});
-    return VariantType == static_cast<int32>(TestVariant.GetType());
-}
-
 int32 FVariantWrapper::GetType() const
 {
     return VariantType;
@@ -199,40 +192,4 @@ template FIntVector FVariantWrapper::GetValue<FIntVector>() const;
 #endif
 template FColor FVariantWrapper::GetValue<FColor>() const;
 template FLinearColor FVariantWrapper::GetValue<FLinearColor>() const;
-template FGuid FVariantWrapper::GetValue<FGuid>() const;
-
-// IsType instantiations
-template bool FVariantWrapper::IsType<int8>() const;
-template bool FVariantWrapper::IsType<int16>() const;
-template bool FVariantWrapper::IsType<int32>() const;
-template bool FVariantWrapper::IsType<int64>() const;
-template bool FVariantWrapper::IsType<uint8>() const;
-template bool FVariantWrapper::IsType<uint16>() const;
-template bool FVariantWrapper::IsType<uint32>() const;
-template bool FVariantWrapper::IsType<uint64>() const;
-template bool FVariantWrapper::IsType<float>() const;
-template bool FVariantWrapper::IsType<double>() const;
-template bool FVariantWrapper::IsType<bool>() const;
-template bool FVariantWrapper::IsType<ANSICHAR>() const;
-template bool FVariantWrapper::IsType<WIDECHAR>() const;
-template bool FVariantWrapper::IsType<FString>() const;
-template bool FVariantWrapper::IsType<FName>() const;
-template bool FVariantWrapper::IsType<FDateTime>() const;
-template bool FVariantWrapper::IsType<FTimespan>() const;
-template bool FVariantWrapper::IsType<FVector>() const;
-template bool FVariantWrapper::IsType<FVector2D>() const;
-template bool FVariantWrapper::IsType<FVector4>() const;
-template bool FVariantWrapper::IsType<FRotator>() const;
-template bool FVariantWrapper::IsType<FQuat>() const;
-template bool FVariantWrapper::IsType<FTransform>() const;
-template bool FVariantWrapper::IsType<FMatrix>() const;
-template bool FVariantWrapper::IsType<FPlane>() const;
-template bool FVariantWrapper::IsType<FBox>() const;
-#if ENGINE_MAJOR_VERSION >= 5 && ENGINE_MINOR_VERSION >= 4
-template bool FVariantWrapper::IsType<FIntRect>() const;
-template bool FVariantWrapper::IsType<FIntPoint>() const;
-template bool FVariantWrapper::IsType<FIntVector>() const;
-#endif
-template bool FVariantWrapper::IsType<FColor>() const;
-template bool FVariantWrapper::IsType<FLinearColor>() const;
-template bool FVariantWrapper::IsType<FGuid>() const;
\ No newline at end of file
+template FGuid FVariantWrapper::GetValue<FGuid>() const;
\ No newline at end of file
@@ -0,0 +1,114 @@
+#include "CoreTypes.h"
+#include "Misc/AutomationTest.h"
+#include "Async/ParallelFor.h"
+#include "HippocacheSubsystem.h"
+#include "HippocacheWrapperStructs.h"
+#include "Runtime/Launch/Resources/Version.h"
+#include "Tests/TestStructs.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+// ApplicationContextMask is deprecated in UE 5.6+, use conditional compilation for compatibility
+#if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 6
+DEFINE_SPEC(FHippocacheAtomicSpec, "Hippocache.Atomic",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+#else
+DEFINE_SPEC(FHippocacheAtomicSpec, "Hippocache.Atomic",
+    EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+#endif
+
+void FHippocacheAtomicSpec::Define()
+{
+    Describe("Numeric Operations", [this]()
+    {
+        It("should count in every collection layout", [this]()
+        {
+            UHippocacheSubsystem* Subsystem = NewObject<UHippocacheSubsystem>();
+            FHippocacheCollectionOptions MapOptions;
+            MapOptions.IndexType = EHippocacheIndexType::TMap;
+            Subsystem->CreateCollection(TEXT("Map"), MapOptions);
+            FHippocacheCollectionOptions SlabOptions;
+            SlabOptions.ValueAllocator = EHippocacheValueAllocator::Slab;
+            Subsystem->CreateCollection(TEXT("Slab"), SlabOptions);
+            Subsystem->CreateTypedCollection<FInt32Wrapper>(TEXT("Typed"));
+
+            for (const FName Collection : { FName(TEXT("Flat")), FName(TEXT("Map")), FName(TEXT("Slab")), FName(TEXT("Typed")) })
+            {
+                // A missing counter starts from zero
+                TestEqual(FString::Printf(TEXT("%s: Increment should create the counter"), *Collection.ToString()), Subsystem->Increment<int32>(Collection, TEXT("Hits")).Value, 1);
+                TestEqual(FString::Printf(TEXT("%s: Add should return the new value"), *Collection.ToString()), Subsystem->Add(Collection, FHippocacheKey(TEXT("Hits")), 10).Value, 11);
+                TestEqual(FString::Printf(TEXT("%s: Decrement should return the new value"), *Collection.ToString()), Subsystem->Decrement<int32>(Collection, TEXT("Hits")).Value, 10);
+
+                // The counter is an ordinary FInt32Wrapper value
+                TestEqual(FString::Printf(TEXT("%s: Get should see the counter"), *Collection.ToString()), Subsystem->GetStructTyped<FInt32Wrapper>(Collection, TEXT("Hits")).Value.Value, 10);
+                Subsystem->SetStruct(Collection, TEXT("Hits"), FInt32Wrapper(100));
+                TestEqual(FString::Printf(TEXT("%s: Add should continue from a set value"), *Collection.ToString()), Subsystem->Add(Collection, TEXT("Hits"), 5).Value, 105);
+            }
+        });
+
+        It("should compare and swap, and keep minimums and maximums", [this]()
+        {
+            UHippocacheSubsystem* Subsystem = NewObject<UHippocacheSubsystem>();
+
+            Subsystem->SetStruct(TEXT("AtomicTest"), TEXT("Version"), FInt64Wrapper(7));
+            THippocacheResult<int64> Swap = Subsystem->CompareAndSwap<int64>(TEXT("AtomicTest"), TEXT("Version"), 7, 8);
+            TestTrue("Matching swap should succeed", Swap.IsSuccess());
+            TestEqual("Matching swap should report the old value", Swap.Value, int64(7));
+            Swap = Subsystem->CompareAndSwap<int64>(TEXT("AtomicTest"), TEXT("Version"), 7, 9);
+            TestEqual("Stale swap should report the current value", Swap.Value, int64(8));
+            TestEqual("Stale swap should not change the value", Subsystem->GetStructTyped<FInt64Wrapper>(TEXT("AtomicTest"), TEXT("Version")).Value.Value, int64(8));
+            TestEqual("Swap on a missing key should fail", Subsystem->CompareAndSwap<int64>(TEXT("AtomicTest"), TEXT("Missing"), 0, 1).Result.ErrorCode, EHippocacheErrorCode::ItemNotFound);
+
+            TestEqual("FetchMin on a missing key should report the operand", Subsystem->FetchMin(TEXT("AtomicTest"), TEXT("Fastest"), 12.5f).Value, 12.5f);
+            TestEqual("FetchMin should report the previous value", Subsystem->FetchMin(TEXT("AtomicTest"), TEXT("Fastest"), 9.0f).Value, 12.5f);
+            Subsystem->FetchMin(TEXT("AtomicTest"), TEXT("Fastest"), 20.0f);
+            TestEqual("FetchMin should keep the smallest value", Subsystem->GetStructTyped<FFloatWrapper>(TEXT("AtomicTest"), TEXT("Fastest")).Value.Value, 9.0f);
+
+            Subsystem->FetchMax(TEXT("AtomicTest"), FHippocacheKey(TEXT("Best")), 3.0);
+            Subsystem->FetchMax(TEXT("AtomicTest"), FHippocacheKey(TEXT("Best")), 1.0);
+            TestEqual("FetchMax should keep the largest value", Subsystem->FetchMax(TEXT("AtomicTest"), FHippocacheKey(TEXT("Best")), 2.0).Value, 3.0);
+        });
+
+        It("should reject values of another type and restart expired counters", [this]()
+        {
+            UHippocacheSubsystem* Subsystem = NewObject<UHippocacheSubsystem>();
+            FTestStruct Value;
+            Subsystem->SetStruct(TEXT("AtomicTest"), TEXT("Struct"), Value);
+            Subsystem->SetStruct(TEXT("AtomicTest"), TEXT("Int64"), FInt64Wrapper(1));
+            Subsystem->SetStructWithTTL(TEXT("AtomicTest"), TEXT("Expired"), FInt32Wrapper(50), FTimespan::FromMilliseconds(1.0));
+            Subsystem->SetStructWithTTL(TEXT("AtomicTest"), TEXT("ExpiredVersion"), FInt32Wrapper(50), FTimespan::FromMilliseconds(1.0));
+            FPlatformProcess::Sleep(0.01f);
+
+            TestEqual("A struct is not a counter", Subsystem->Increment<int32>(TEXT("AtomicTest"), TEXT("Struct")).Result.ErrorCode, EHippocacheErrorCode::TypeMismatch);
+            TestEqual("An int64 counter is not an int32 counter", Subsystem->Increment<int32>(TEXT("AtomicTest"), TEXT("Int64")).Result.ErrorCode, EHippocacheErrorCode::TypeMismatch);
+            TestEqual("The int64 counter should be untouched", Subsystem->GetStructTyped<FInt64Wrapper>(TEXT("AtomicTest"), TEXT("Int64")).Value.Value, int64(1));
+
+            TestEqual("An expired counter should start over", Subsystem->Increment<int32>(TEXT("AtomicTest"), TEXT("Expired")).Value, 1);
+            TestEqual("Swap on an expired counter should fail", Subsystem->CompareAndSwap<int32>(TEXT("AtomicTest"), TEXT("ExpiredVersion"), 50, 51).Result.ErrorCode, EHippocacheErrorCode::ItemExpired);
+        });
+
+        It("should not lose concurrent increments", [this]()
+        {
+            UHippocacheSubsystem* Subsystem = NewObject<UHippocacheSubsystem>();
+            FHippocacheCollectionHandle Handle;
+            Subsystem->CreateOrGetCollection(TEXT("AtomicTest"), Handle);
+
+            const int32 NumThreads = 8;
+            const int32 IncrementsPerThread = 1000;
+            const FHippocacheKey Key(TEXT("Counter"));
+            ParallelFor(NumThreads, [Subsystem, Handle, &Key, IncrementsPerThread](int32 ThreadIndex)
+            {
+                for (int32 Index = 0; Index < IncrementsPerThread; ++Index)
+                {
+                    Subsystem->Increment<int32>(Handle, Key);
+                    Subsystem->FetchMax<int64>(Handle, TEXT("Highest"), int64(ThreadIndex) * IncrementsPerThread + Index);
+                }
+            });
+
+            TestEqual("Every increment should be applied", Subsystem->GetStructTyped<FInt32Wrapper>(TEXT("AtomicTest"), Key).Value.Value, NumThreads * IncrementsPerThread);
+            TestEqual("The largest value should win", Subsystem->GetStructTyped<FInt64Wrapper>(TEXT("AtomicTest"), TEXT("Highest")).Value.Value, int64(NumThreads * IncrementsPerThread - 1));
+        });
+    });
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
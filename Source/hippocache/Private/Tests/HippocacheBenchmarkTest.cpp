@@ -408,7 +408,7 @@ void BenchmarkLValueRValueComparison(FHippocacheBenchmarkContext& Context, const
     
     double LValueTotalTime = FPlatformTime::Seconds() - LValueStartTime;
 
-    // Benchmark 2: RValue operations (move semantics potential)
+    // Benchmark 2: RValue operations (move semantics)
     TArray<double> RValueTimes;
     double RValueStartTime = FPlatformTime::Seconds();
     
@@ -416,8 +416,8 @@ void BenchmarkLValueRValueComparison(FHippocacheBenchmarkContext& Context, const
     {
         FString Key = FString::Printf(TEXT("RValue_Key_%d"), i);
         
+        T TempValue = TestData[i];  // Create copy for move, outside the timed region
         double OpStartTime = FPlatformTime::Seconds();
-        T TempValue = TestData[i];  // Create copy for move
         FHippocacheResult Result = Context.Subsystem->SetStruct(RValueCollection, Key, MoveTemp(TempValue));
         double OpEndTime = FPlatformTime::Seconds();
         
@@ -508,7 +508,7 @@ bool FHippocacheRValueBenchmarkTest::RunTest(const FString& Parameters)
     AddInfo(TEXT("=== Hippocache RValue vs LValue Performance Benchmark ==="));
     AddInfo(FString::Printf(TEXT("Starting benchmark at: %s"), *FDateTime::Now().ToString()));
     AddInfo(TEXT("This test compares performance between LValue (copy) and RValue (move) operations"));
-    AddInfo(TEXT("Current implementation uses const T& (always copy) - we're testing potential improvement"));
+    AddInfo(TEXT("LValues are copied into the cache once; RValues are moved, so large structs skip the deep copy"));
     
     // Test with different struct sizes
     
@@ -520,11 +520,10 @@ bool FHippocacheRValueBenchmarkTest::RunTest(const FString& Parameters)
     
     AddInfo(TEXT(""));
     AddInfo(TEXT("=== Analysis ==="));
-    AddInfo(TEXT("Current SetStruct implementation: template<typename T> SetStruct(const T& Value)"));
-    AddInfo(TEXT("Proposed optimization: template<typename T> SetStruct(T&& Value) with std::forward<T>"));
+    AddInfo(TEXT("SetStruct(const T& Value) copy-constructs the value directly in its cache slot"));
+    AddInfo(TEXT("SetStruct(T&& Value) move-constructs it there instead, so containers change owners rather than being copied"));
     AddInfo(TEXT(""));
-    AddInfo(TEXT("If RValue shows significant performance improvement, especially for large structs,"));
-    AddInfo(TEXT("implementing universal reference would be beneficial."));
+    AddInfo(TEXT("Small plain-old-data structs cost the same either way; the gap should grow with the struct's heap-owned data."));
     
     AddInfo(FString::Printf(TEXT("Benchmark completed at: %s"), *FDateTime::Now().ToString()));
     
@@ -281,6 +281,115 @@ void FHippocacheBlueprintLibrarySpec::Define()
             TestHelper.CleanupBlueprintTest(TestContext);
         });
 
+        It("should cache double Blueprint variables through the universal nodes", [this]()
+        {
+            FHippocacheBlueprintTestContext TestContext;
+            FHippocacheBlueprintTestHelper TestHelper;
+            if (!TestHelper.SetupBlueprintTest(TestContext, this))
+            {
+                return;
+            }
+            
+            // Blueprint doubles are FDoubleProperty, and engine struct members like FVector::X are its
+            // FLargeWorldCoordinatesRealProperty subclass
+            FDoubleProperty BlueprintVariable(FFieldVariant(), TEXT("BlueprintDouble"), RF_Public);
+            FLargeWorldCoordinatesRealProperty RealVariable(FFieldVariant(), TEXT("BlueprintReal"), RF_Public);
+            FName CollectionName = "BlueprintTestCollection";
+            
+            for (FProperty* Property : TArray<FProperty*>{ &BlueprintVariable, &RealVariable })
+            {
+                const FHippocacheKey Key(Property->GetName());
+                double SetValue = 6.02214076e23;
+                FHippocacheResult SetResult = UHippocacheBlueprintLibrary::ExecuteHippooForProperty(
+                    TestContext.TestWorld, CollectionName, Key, Property, &SetValue, 0.0f, false);
+                TestTrue(FString::Printf(TEXT("Hippoo should accept %s"), *Property->GetClass()->GetName()), SetResult.IsSuccess());
+                
+                double GetValue = 0.0;
+                FHippocacheResult GetResult = UHippocacheBlueprintLibrary::ExecuteHippopForProperty(
+                    TestContext.TestWorld, CollectionName, Key, Property, &GetValue);
+                TestTrue(FString::Printf(TEXT("Hippop should accept %s"), *Property->GetClass()->GetName()), GetResult.IsSuccess());
+                TestEqual("Values should match", GetValue, SetValue);
+                
+                // Stored as a native double, so the typed getter reads it too
+                double TypedValue = 0.0;
+                UHippocacheBlueprintLibrary::GetDouble(TestContext.TestWorld, CollectionName, Key.GetKey(), TypedValue);
+                TestEqual("GetDouble should see the same value", TypedValue, SetValue);
+            }
+            
+            TestHelper.CleanupBlueprintTest(TestContext);
+        });
+
+        It("should update numbers set through the typed setters atomically", [this]()
+        {
+            FHippocacheBlueprintTestContext TestContext;
+            FHippocacheBlueprintTestHelper TestHelper;
+            if (!TestHelper.SetupBlueprintTest(TestContext, this))
+            {
+                return;
+            }
+            
+            FName CollectionName = "BlueprintTestCollection";
+            UHippocacheBlueprintLibrary::SetInt32(TestContext.TestWorld, CollectionName, TEXT("Score"), 40);
+            
+            int32 NewValue = 0;
+            TestTrue("IncrementInt32 should succeed", UHippocacheBlueprintLibrary::IncrementInt32(TestContext.TestWorld, CollectionName, TEXT("Score"), NewValue).IsSuccess());
+            TestTrue("AddInt32 should succeed", UHippocacheBlueprintLibrary::AddInt32(TestContext.TestWorld, CollectionName, TEXT("Score"), 1, NewValue).IsSuccess());
+            TestEqual("Both updates should apply", NewValue, 42);
+            
+            int32 GetValue = 0;
+            UHippocacheBlueprintLibrary::GetInt32(TestContext.TestWorld, CollectionName, TEXT("Score"), GetValue);
+            TestEqual("GetInt32 should see the updated value", GetValue, 42);
+            
+            float PreviousValue = 0.0f;
+            bool bSwapped = false;
+            UHippocacheBlueprintLibrary::SetFloat(TestContext.TestWorld, CollectionName, TEXT("Speed"), 1.5f);
+            UHippocacheBlueprintLibrary::CompareAndSwapFloat(TestContext.TestWorld, CollectionName, TEXT("Speed"), 2.0f, 3.0f, PreviousValue, bSwapped);
+            TestFalse("A stale swap should not apply", bSwapped);
+            UHippocacheBlueprintLibrary::CompareAndSwapFloat(TestContext.TestWorld, CollectionName, TEXT("Speed"), 1.5f, 3.0f, PreviousValue, bSwapped);
+            TestTrue("A matching swap should apply", bSwapped);
+            TestEqual("The swap should report the old value", PreviousValue, 1.5f);
+            
+            TestHelper.CleanupBlueprintTest(TestContext);
+        });
+
+        It("should cache primitives natively rather than as serialized variants", [this]()
+        {
+            FHippocacheBlueprintTestContext TestContext;
+            FHippocacheBlueprintTestHelper TestHelper;
+            if (!TestHelper.SetupBlueprintTest(TestContext, this))
+            {
+                return;
+            }
+            
+            FName CollectionName = "BlueprintTestCollection";
+            UHippocacheBlueprintLibrary::SetBool(TestContext.TestWorld, CollectionName, TEXT("Flag"), true);
+            UHippocacheBlueprintLibrary::SetName(TestContext.TestWorld, CollectionName, TEXT("Name"), TEXT("Hippo"));
+            UHippocacheBlueprintLibrary::SetTimespan(TestContext.TestWorld, CollectionName, TEXT("Cooldown"), FTimespan::FromSeconds(2.5));
+            UHippocacheBlueprintLibrary::SetVector(TestContext.TestWorld, CollectionName, TEXT("Location"), FVector(1.0, 2.0, 3.0));
+            
+            // Primitives live in their wrapper struct, engine structs as themselves
+            THippocacheResult<FInstancedStruct> Stored = UHippocacheBlueprintLibrary::GetStruct<FInstancedStruct>(TestContext.TestWorld, CollectionName, TEXT("Flag"));
+            TestTrue("Bool should be cached as FBoolWrapper", Stored.Value.GetScriptStruct() == FBoolWrapper::StaticStruct());
+            Stored = UHippocacheBlueprintLibrary::GetStruct<FInstancedStruct>(TestContext.TestWorld, CollectionName, TEXT("Location"));
+            TestTrue("Vector should be cached as FVector", Stored.Value.GetScriptStruct() == TBaseStructure<FVector>::Get());
+            TestEqual("Vector should be readable as a struct", Stored.Value.Get<FVector>(), FVector(1.0, 2.0, 3.0));
+            
+            bool bFlag = false;
+            FName Name;
+            FTimespan Cooldown;
+            TestTrue("GetBool should succeed", UHippocacheBlueprintLibrary::GetBool(TestContext.TestWorld, CollectionName, TEXT("Flag"), bFlag).IsSuccess());
+            TestTrue("Bool should round-trip", bFlag);
+            UHippocacheBlueprintLibrary::GetName(TestContext.TestWorld, CollectionName, TEXT("Name"), Name);
+            TestEqual("Name should round-trip", Name, FName(TEXT("Hippo")));
+            UHippocacheBlueprintLibrary::GetTimespan(TestContext.TestWorld, CollectionName, TEXT("Cooldown"), Cooldown);
+            TestEqual("Timespan should round-trip", Cooldown, FTimespan::FromSeconds(2.5));
+            
+            uint8 Byte = 0;
+            TestEqual("Reading a bool as a byte should fail", UHippocacheBlueprintLibrary::GetByte(TestContext.TestWorld, CollectionName, TEXT("Flag"), Byte).ErrorCode, EHippocacheErrorCode::TypeMismatch);
+            
+            TestHelper.CleanupBlueprintTest(TestContext);
+        });
+
         It("should set and get String value successfully", [this]()
         {
             FHippocacheBlueprintTestContext TestContext;
@@ -2007,6 +2116,84 @@ void FHippocacheBlueprintLibrarySpec::Define()
         });
     });
 
+    Describe("Blueprint Library Key Handles", [this]()
+    {
+        It("should share entries between string keys and precomputed keys", [this]()
+        {
+            FHippocacheBlueprintTestContext TestContext;
+            FHippocacheBlueprintTestHelper TestHelper;
+            if (!TestHelper.SetupBlueprintTest(TestContext, this))
+            {
+                return;
+            }
+
+            FName CollectionName = "KeyHandleTest";
+            const FHippocacheKey Key = UHippocacheBlueprintLibrary::MakeHippocacheKey(TEXT("PlayerScore"));
+            TestTrue("Key should be valid", Key.IsValid());
+            TestEqual("Key hash should match the string hash", Key.GetHash(), FHippocacheKey::HashString(TEXT("playerscore")));
+
+            // Written through the key, read back through the string
+            TestTrue("SetPrimitive with key should succeed", UHippocacheBlueprintLibrary::SetPrimitive<int32>(
+                TestContext.TestWorld, CollectionName, Key, 42).IsSuccess());
+            int32 GetValue = 0;
+            TestTrue("GetInt32 with string should succeed", UHippocacheBlueprintLibrary::GetInt32(
+                TestContext.TestWorld, CollectionName, TEXT("PlayerScore"), GetValue).IsSuccess());
+            TestEqual("Value should match", GetValue, 42);
+
+            // Written through the string, read back through the key
+            FTestStruct SetStruct;
+            SetStruct.IntValue = 7;
+            SetStruct.StringValue = TEXT("Seven");
+            TestTrue("Hippoo with string should succeed", UHippocacheBlueprintLibrary::Hippoo(
+                TestContext.TestWorld, CollectionName, FString(TEXT("Struct")), SetStruct).IsSuccess());
+            FTestStruct GetStruct;
+            TestTrue("Hippop with key should succeed", UHippocacheBlueprintLibrary::Hippop(
+                TestContext.TestWorld, CollectionName, FHippocacheKey(TEXT("STRUCT")), GetStruct).IsSuccess());
+            TestEqual("Struct IntValue should match", GetStruct.IntValue, 7);
+            TestEqual("Struct StringValue should match", GetStruct.StringValue, SetStruct.StringValue);
+
+            TestTrue("Remove with key should succeed", UHippocacheBlueprintLibrary::Remove(
+                TestContext.TestWorld, CollectionName, Key).IsSuccess());
+            FHippocacheResult GetAfterRemove = UHippocacheBlueprintLibrary::GetInt32(
+                TestContext.TestWorld, CollectionName, TEXT("PlayerScore"), GetValue);
+            TestEqual("Should return ItemNotFound after removal", GetAfterRemove.ErrorCode, EHippocacheErrorCode::ItemNotFound);
+
+            TestHelper.CleanupBlueprintTest(TestContext);
+        });
+    });
+
+    Describe("Blueprint Library Subsystem Resolution", [this]()
+    {
+        It("should resolve each world's own subsystem across repeated calls", [this]()
+        {
+            FHippocacheBlueprintTestContext FirstContext;
+            FHippocacheBlueprintTestContext SecondContext;
+            FHippocacheBlueprintTestHelper TestHelper;
+            if (!TestHelper.SetupBlueprintTest(FirstContext, this) || !TestHelper.SetupBlueprintTest(SecondContext, this))
+            {
+                return;
+            }
+            
+            UHippocacheSubsystem* FirstExpected = FirstContext.TestWorld->GetGameInstance()->GetSubsystem<UHippocacheSubsystem>();
+            UHippocacheSubsystem* SecondExpected = SecondContext.TestWorld->GetGameInstance()->GetSubsystem<UHippocacheSubsystem>();
+            
+            // Alternate between the worlds so the cached resolution has to switch every time
+            for (int32 Round = 0; Round < 2; ++Round)
+            {
+                UHippocacheSubsystem* Subsystem = nullptr;
+                UHippocacheSubsystem::Get(FirstContext.TestWorld, Subsystem);
+                TestEqual("The first world should resolve its own subsystem", Subsystem, FirstExpected);
+                UHippocacheSubsystem::Get(FirstContext.TestWorld, Subsystem);
+                TestEqual("A repeated call should resolve the same subsystem", Subsystem, FirstExpected);
+                UHippocacheSubsystem::Get(SecondContext.TestWorld, Subsystem);
+                TestEqual("The second world should resolve its own subsystem", Subsystem, SecondExpected);
+            }
+            
+            TestHelper.CleanupBlueprintTest(SecondContext);
+            TestHelper.CleanupBlueprintTest(FirstContext);
+        });
+    });
+
     Describe("Blueprint Library Management Operations", [this]()
     {
         It("should remove items successfully", [this]()
@@ -0,0 +1,106 @@
+#include "CoreTypes.h"
+#include "Misc/AutomationTest.h"
+#include "HippocacheSubsystem.h"
+#include "Runtime/Launch/Resources/Version.h"
+#include "Tests/TestStructs.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+// ApplicationContextMask is deprecated in UE 5.6+, use conditional compilation for compatibility
+#if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 6
+DEFINE_SPEC(FHippocacheCollectionHandleSpec, "Hippocache.CollectionHandle",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+#else
+DEFINE_SPEC(FHippocacheCollectionHandleSpec, "Hippocache.CollectionHandle",
+    EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+#endif
+
+void FHippocacheCollectionHandleSpec::Define()
+{
+    Describe("Collection Handles", [this]()
+    {
+        It("should share items with the name-based API", [this]()
+        {
+            UHippocacheSubsystem* Subsystem = NewObject<UHippocacheSubsystem>();
+            FHippocacheCollectionHandle Handle;
+            TestTrue("CreateOrGetCollection should succeed", Subsystem->CreateOrGetCollection(TEXT("HandleTest"), Handle).IsSuccess());
+            TestTrue("Handle should be valid", Handle.IsValid());
+            TestEqual("Handle should carry the collection name", Handle.GetName(), FName(TEXT("HandleTest")));
+
+            FTestStruct Value;
+            Value.IntValue = 11;
+            TestTrue("Set through handle should succeed", Subsystem->SetStruct(Handle, TEXT("Key"), FInstancedStruct::Make(Value)).IsSuccess());
+
+            FInstancedStruct OutValue;
+            TestTrue("Get by name should find it", Subsystem->GetStruct(TEXT("HandleTest"), TEXT("Key"), OutValue).IsSuccess());
+            TestEqual("Value should match", OutValue.Get<FTestStruct>().IntValue, 11);
+
+            Value.IntValue = 12;
+            TestTrue("Set by name should succeed", Subsystem->SetStruct(TEXT("HandleTest"), FHippocacheKey(TEXT("Other")), FInstancedStruct::Make(Value)).IsSuccess());
+            TestTrue("Get through handle should find it", Subsystem->GetStruct(Handle, FHippocacheKey(TEXT("Other")), OutValue).IsSuccess());
+            TestEqual("Value should match", OutValue.Get<FTestStruct>().IntValue, 12);
+
+            int32 Count = 0;
+            TestTrue("Num through handle should succeed", Subsystem->Num(Handle, Count).IsSuccess());
+            TestEqual("Both items should be counted", Count, 2);
+
+            TestTrue("Remove through handle should succeed", Subsystem->Remove(Handle, TEXT("Key")).IsSuccess());
+            TestEqual("Removed item should be gone", Subsystem->GetStruct(Handle, TEXT("Key"), OutValue).ErrorCode, EHippocacheErrorCode::ItemNotFound);
+        });
+
+        It("should resolve the same collection on repeated calls", [this]()
+        {
+            UHippocacheSubsystem* Subsystem = NewObject<UHippocacheSubsystem>();
+            FHippocacheCollectionHandle First;
+            FHippocacheCollectionHandle Second;
+            Subsystem->CreateOrGetCollection(TEXT("HandleTest"), First);
+            Subsystem->CreateOrGetCollection(TEXT("HandleTest"), Second);
+
+            FTestStruct Value;
+            Subsystem->SetStruct(First, TEXT("Key"), FInstancedStruct::Make(Value));
+
+            int32 Count = 0;
+            Subsystem->Num(Second, Count);
+            TestEqual("Both handles should see the same items", Count, 1);
+        });
+
+        It("should fail once the collection is removed", [this]()
+        {
+            UHippocacheSubsystem* Subsystem = NewObject<UHippocacheSubsystem>();
+            FHippocacheCollectionHandle Handle;
+            Subsystem->CreateOrGetCollection(TEXT("HandleTest"), Handle);
+
+            FTestStruct Value;
+            Subsystem->SetStruct(Handle, TEXT("Key"), FInstancedStruct::Make(Value));
+
+            TestTrue("RemoveCollection should succeed", Subsystem->RemoveCollection(TEXT("HandleTest")).IsSuccess());
+            TestFalse("Handle should be invalid", Handle.IsValid());
+
+            FInstancedStruct OutValue;
+            TestEqual("Get through a stale handle should fail", Subsystem->GetStruct(Handle, TEXT("Key"), OutValue).ErrorCode, EHippocacheErrorCode::InvalidCollection);
+            TestEqual("Set through a stale handle should fail", Subsystem->SetStruct(Handle, TEXT("Key"), FInstancedStruct::Make(Value)).ErrorCode, EHippocacheErrorCode::InvalidCollection);
+            TestEqual("The collection should be gone by name", Subsystem->GetStruct(TEXT("HandleTest"), TEXT("Key"), OutValue).ErrorCode, EHippocacheErrorCode::ItemNotFound);
+            TestEqual("Removing it again should fail", Subsystem->RemoveCollection(TEXT("HandleTest")).ErrorCode, EHippocacheErrorCode::ItemNotFound);
+
+            // A fresh handle resolves the recreated collection, which starts empty
+            FHippocacheCollectionHandle NewHandle;
+            Subsystem->CreateOrGetCollection(TEXT("HandleTest"), NewHandle);
+            int32 Count = -1;
+            TestTrue("Num through the new handle should succeed", Subsystem->Num(NewHandle, Count).IsSuccess());
+            TestEqual("Recreated collection should be empty", Count, 0);
+        });
+
+        It("should reject empty handles and None names", [this]()
+        {
+            UHippocacheSubsystem* Subsystem = NewObject<UHippocacheSubsystem>();
+            FHippocacheCollectionHandle Handle;
+            TestFalse("Default handle should be invalid", Handle.IsValid());
+
+            FInstancedStruct OutValue;
+            TestEqual("Get through an empty handle should fail", Subsystem->GetStruct(Handle, TEXT("Key"), OutValue).ErrorCode, EHippocacheErrorCode::InvalidCollection);
+            TestEqual("None collection should fail", Subsystem->CreateOrGetCollection(NAME_None, Handle).ErrorCode, EHippocacheErrorCode::InvalidCollection);
+        });
+    });
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
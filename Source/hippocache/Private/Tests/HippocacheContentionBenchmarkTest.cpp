@@ -0,0 +1,147 @@
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "Async/Async.h"
+#include "HAL/PlatformTime.h"
+#include "HippocacheSubsystem.h"
+#include "Runtime/Launch/Resources/Version.h"
+#include "Tests/TestStructs.h"
+
+#include <atomic>
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+// ApplicationContextMask is deprecated in UE 5.6+, use conditional compilation for compatibility
+#if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 6
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FHippocacheContentionBenchmarkTest, "Hippocache.Performance.Contention",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter | EAutomationTestFlags::HighPriority)
+#else
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FHippocacheContentionBenchmarkTest, "Hippocache.Performance.Contention",
+    EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter | EAutomationTestFlags::HighPriority)
+#endif
+
+namespace HippocacheContentionBenchmark
+{
+    constexpr int32 KeyCount = 1024;
+    constexpr double RunSeconds = 1.0;
+
+    /**
+     * Fills a collection with KeyCount struct items
+     */
+    void Populate(UHippocacheSubsystem* Subsystem, FName Collection)
+    {
+        for (int32 i = 0; i < KeyCount; ++i)
+        {
+            FTestStruct Value;
+            Value.IntValue = i;
+            Value.StringValue = FString::Printf(TEXT("Value_%d"), i);
+            Subsystem->SetStruct(Collection, FString::Printf(TEXT("Key_%d"), i), FInstancedStruct::Make(Value));
+        }
+    }
+
+    /**
+     * Runs one writer thread on WriteCollection and ReaderCount reader threads on ReadCollection
+     * for RunSeconds, and returns the combined reader throughput in ops/sec.
+     */
+    double RunScenario(UHippocacheSubsystem* Subsystem, FName WriteCollection, FName ReadCollection, int32 ReaderCount, double& OutWriterOpsPerSecond)
+    {
+        std::atomic<bool> bStop { false };
+        std::atomic<int64> ReadOps { 0 };
+        std::atomic<int64> WriteOps { 0 };
+
+        // Pre-build keys so the measured loop is dominated by cache access, not string formatting
+        TArray<FString> Keys;
+        Keys.Reserve(KeyCount);
+        for (int32 i = 0; i < KeyCount; ++i)
+        {
+            Keys.Add(FString::Printf(TEXT("Key_%d"), i));
+        }
+
+        TArray<TFuture<void>> Workers;
+
+        Workers.Add(Async(EAsyncExecution::Thread, [&]()
+        {
+            int64 LocalOps = 0;
+            FTestStruct Value;
+            while (!bStop.load(std::memory_order_relaxed))
+            {
+                Value.IntValue = static_cast<int32>(LocalOps);
+                Subsystem->SetStruct(WriteCollection, Keys[LocalOps % KeyCount], FInstancedStruct::Make(Value));
+                ++LocalOps;
+            }
+            WriteOps.fetch_add(LocalOps, std::memory_order_relaxed);
+        }));
+
+        for (int32 ReaderIndex = 0; ReaderIndex < ReaderCount; ++ReaderIndex)
+        {
+            Workers.Add(Async(EAsyncExecution::Thread, [&, ReaderIndex]()
+            {
+                int64 LocalOps = 0;
+                FInstancedStruct OutValue;
+                while (!bStop.load(std::memory_order_relaxed))
+                {
+                    Subsystem->GetStruct(ReadCollection, Keys[(LocalOps + ReaderIndex * 97) % KeyCount], OutValue);
+                    ++LocalOps;
+                }
+                ReadOps.fetch_add(LocalOps, std::memory_order_relaxed);
+            }));
+        }
+
+        const double StartTime = FPlatformTime::Seconds();
+        FPlatformProcess::Sleep(RunSeconds);
+        bStop.store(true, std::memory_order_relaxed);
+        for (TFuture<void>& Worker : Workers)
+        {
+            Worker.Wait();
+        }
+        const double Elapsed = FPlatformTime::Seconds() - StartTime;
+
+        OutWriterOpsPerSecond = WriteOps.load() / Elapsed;
+        return ReadOps.load() / Elapsed;
+    }
+}
+
+bool FHippocacheContentionBenchmarkTest::RunTest(const FString& Parameters)
+{
+    using namespace HippocacheContentionBenchmark;
+
+    UHippocacheSubsystem* Subsystem = NewObject<UHippocacheSubsystem>();
+    if (!TestNotNull(TEXT("Subsystem should be created"), Subsystem))
+    {
+        return false;
+    }
+
+    const FName WriteCollection = TEXT("Inventory");
+    const FName ReadCollection = TEXT("Matchmaking");
+    Populate(Subsystem, WriteCollection);
+    Populate(Subsystem, ReadCollection);
+
+    AddInfo(TEXT("=== Hippocache Multi-threaded Contention Benchmark ==="));
+    AddInfo(FString::Printf(TEXT("Shards per collection: %d, keys per collection: %d"), Subsystem->GetShardCount(), KeyCount));
+
+    const int32 ReaderCounts[] = { 1, 2, 4, 8 };
+    for (const int32 ReaderCount : ReaderCounts)
+    {
+        double CrossWriterOps = 0.0;
+        const double CrossReadOps = RunScenario(Subsystem, WriteCollection, ReadCollection, ReaderCount, CrossWriterOps);
+
+        double SameWriterOps = 0.0;
+        const double SameReadOps = RunScenario(Subsystem, WriteCollection, WriteCollection, ReaderCount, SameWriterOps);
+
+        AddInfo(FString::Printf(TEXT("--- %d reader thread(s), 1 writer thread ---"), ReaderCount));
+        AddInfo(FString::Printf(TEXT("Readers on other collection: %.2f reads/sec (writer %.2f writes/sec)"), CrossReadOps, CrossWriterOps));
+        AddInfo(FString::Printf(TEXT("Readers on same collection:  %.2f reads/sec (writer %.2f writes/sec)"), SameReadOps, SameWriterOps));
+
+        TestTrue(FString::Printf(TEXT("Readers should make progress with %d threads"), ReaderCount), CrossReadOps > 0.0 && SameReadOps > 0.0);
+    }
+
+    // Contention must not corrupt the collections
+    int32 Count = 0;
+    TestTrue(TEXT("Write collection should be countable"), Subsystem->Num(WriteCollection, Count).IsSuccess());
+    TestEqual(TEXT("Write collection should keep its key set"), Count, KeyCount);
+    TestTrue(TEXT("Read collection should be countable"), Subsystem->Num(ReadCollection, Count).IsSuccess());
+    TestEqual(TEXT("Read collection should keep its key set"), Count, KeyCount);
+
+    return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,293 @@
+#include "CoreTypes.h"
+#include "Misc/AutomationTest.h"
+#include "Async/Async.h"
+#include "HippocacheCollection.h"
+#include "HippocacheEpoch.h"
+#include "Runtime/Launch/Resources/Version.h"
+#include "Tests/TestStructs.h"
+
+#include <atomic>
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace HippocacheEpochTest
+{
+    // Counts its own destruction so tests can observe when reclamation happens
+    struct FTrackedObject
+    {
+        std::atomic<int32>* DeleteCount = nullptr;
+
+        ~FTrackedObject()
+        {
+            DeleteCount->fetch_add(1);
+        }
+    };
+}
+
+// ApplicationContextMask is deprecated in UE 5.6+, use conditional compilation for compatibility
+#if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 6
+DEFINE_SPEC(FHippocacheEpochSpec, "Hippocache.Epoch",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+#else
+DEFINE_SPEC(FHippocacheEpochSpec, "Hippocache.Epoch",
+    EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+#endif
+
+void FHippocacheEpochSpec::Define()
+{
+    using namespace HippocacheEpochTest;
+
+    Describe("Epoch Reclamation", [this]()
+    {
+        It("should defer deletion while a read scope is active", [this]()
+        {
+            std::atomic<int32> DeleteCount { 0 };
+            {
+                FHippocacheEpoch::FReadScope EpochScope;
+                FHippocacheEpoch::Retire(new FTrackedObject{ &DeleteCount });
+                FHippocacheEpoch::Reclaim();
+                TestEqual("Retired object should survive while this thread is reading", DeleteCount.load(), 0);
+            }
+
+            FHippocacheEpoch::Reclaim();
+            TestEqual("Retired object should be deleted once the read scope ends", DeleteCount.load(), 1);
+        });
+
+        It("should keep the epoch pinned until the outermost scope ends", [this]()
+        {
+            std::atomic<int32> DeleteCount { 0 };
+            {
+                FHippocacheEpoch::FReadScope OuterScope;
+                {
+                    FHippocacheEpoch::FReadScope InnerScope;
+                    FHippocacheEpoch::Retire(new FTrackedObject{ &DeleteCount });
+                }
+                FHippocacheEpoch::Reclaim();
+                TestEqual("Leaving a nested scope should not unpin the thread", DeleteCount.load(), 0);
+            }
+
+            FHippocacheEpoch::Reclaim();
+            TestEqual("Retired object should be deleted after the outer scope ends", DeleteCount.load(), 1);
+        });
+
+        It("should delete in retirement order while several threads reclaim", [this]()
+        {
+            const int32 NumObjects = 20000;
+            FHippocacheEpoch::Reclaim();
+
+            // Each object records the position it was deleted at
+            TArray<int32> DeletedAt;
+            DeletedAt.Init(INDEX_NONE, NumObjects);
+            static std::atomic<int32> NextPosition;
+            NextPosition = 0;
+            struct FOrderedObject
+            {
+                int32* Slot;
+                ~FOrderedObject() { *Slot = NextPosition.fetch_add(1); }
+            };
+
+            std::atomic<bool> bRetiring { true };
+            TArray<TFuture<void>> Reclaimers;
+            for (int32 Thread = 0; Thread < 3; ++Thread)
+            {
+                Reclaimers.Add(Async(EAsyncExecution::Thread, [&bRetiring]()
+                {
+                    while (bRetiring.load())
+                    {
+                        FHippocacheEpoch::Reclaim();
+                    }
+                }));
+            }
+            for (int32 Index = 0; Index < NumObjects; ++Index)
+            {
+                FHippocacheEpoch::Retire(new FOrderedObject{ &DeletedAt[Index] });
+            }
+            bRetiring = false;
+            for (TFuture<void>& Reclaimer : Reclaimers)
+            {
+                Reclaimer.Wait();
+            }
+            FHippocacheEpoch::Reclaim();
+
+            bool bInOrder = true;
+            for (int32 Index = 0; Index < NumObjects; ++Index)
+            {
+                bInOrder &= DeletedAt[Index] == Index;
+            }
+            TestTrue("Every object should be deleted in the order it was retired", bInOrder);
+        });
+    });
+
+    Describe("Lock-free Collection Reads", [this]()
+    {
+        It("should never observe a torn value under concurrent writes", [this]()
+        {
+            constexpr int32 KeyCount = 64;
+            constexpr int32 WriteCount = 20000;
+            constexpr int32 ReaderCount = 4;
+
+            FHippocacheCollection Collection(TEXT("EpochTest"), 4);
+            std::atomic<bool> bStop { false };
+            std::atomic<int32> TornReads { 0 };
+            std::atomic<int64> SuccessfulReads { 0 };
+
+            TArray<TFuture<void>> Readers;
+            for (int32 ReaderIndex = 0; ReaderIndex < ReaderCount; ++ReaderIndex)
+            {
+                Readers.Add(Async(EAsyncExecution::Thread, [&, ReaderIndex]()
+                {
+                    FInstancedStruct OutValue;
+                    int32 Iteration = ReaderIndex;
+                    while (!bStop.load(std::memory_order_relaxed))
+                    {
+                        const FString Key = FString::Printf(TEXT("Key_%d"), Iteration++ % KeyCount);
+                        if (Collection.Get(Key, OutValue).IsSuccess())
+                        {
+                            const FTestStruct& Value = OutValue.Get<FTestStruct>();
+                            if (Value.StringValue != FString::FromInt(Value.IntValue))
+                            {
+                                TornReads.fetch_add(1);
+                            }
+                            SuccessfulReads.fetch_add(1, std::memory_order_relaxed);
+                        }
+                    }
+                }));
+            }
+
+            // Overwrites, removals and table growth all race with the readers
+            for (int32 i = 0; i < WriteCount; ++i)
+            {
+                const FString Key = FString::Printf(TEXT("Key_%d"), i % KeyCount);
+                if (i % 7 == 0)
+                {
+                    Collection.Remove(Key);
+                }
+                else
+                {
+                    FTestStruct Value;
+                    Value.IntValue = i;
+                    Value.StringValue = FString::FromInt(i);
+                    Collection.Set(Key, FInstancedStruct::Make(Value), FTimespan::Zero());
+                }
+            }
+
+            bStop.store(true);
+            for (TFuture<void>& Reader : Readers)
+            {
+                Reader.Wait();
+            }
+
+            TestEqual("Readers should never see a partially written value", TornReads.load(), 0);
+            TestTrue("Readers should have completed some lookups", SuccessfulReads.load() > 0);
+            TestTrue("Collection should hold no more than its key set", Collection.Num() <= KeyCount);
+        });
+
+        It("should treat keys that differ only in case as the same key", [this]()
+        {
+            FHippocacheCollection Collection(TEXT("EpochTest"), 4);
+
+            FTestStruct Value;
+            Value.IntValue = 7;
+            TestTrue("Set should succeed", Collection.Set(TEXT("PlayerScore"), FInstancedStruct::Make(Value), FTimespan::Zero()).IsSuccess());
+            Value.IntValue = 8;
+            TestTrue("Overwrite should succeed", Collection.Set(TEXT("playerscore"), FInstancedStruct::Make(Value), FTimespan::Zero()).IsSuccess());
+
+            FInstancedStruct OutValue;
+            TestTrue("Get should succeed", Collection.Get(TEXT("PLAYERSCORE"), OutValue).IsSuccess());
+            TestEqual("Overwrite should have replaced the value", OutValue.Get<FTestStruct>().IntValue, 8);
+            TestEqual("Only one entry should exist", Collection.Num(), 1);
+        });
+    });
+
+    Describe("Inline Values", [this]()
+    {
+        It("should store small plain-old-data structs inline", [this]()
+        {
+            TestTrue("FVector should be stored inline", FCachedItem::CanStoreInline(TBaseStructure<FVector>::Get()));
+            TestTrue("FRotator should be stored inline", FCachedItem::CanStoreInline(TBaseStructure<FRotator>::Get()));
+            TestFalse("Structs owning strings should not be stored inline", FCachedItem::CanStoreInline(FTestStruct::StaticStruct()));
+        });
+
+        It("should round-trip inline values and reject other types", [this]()
+        {
+            FHippocacheCollection Collection(TEXT("EpochTest"), 4);
+            const FVector Location(1.0, 2.0, 3.0);
+            TestTrue("Set should succeed", Collection.Set(TEXT("Location"), FHippocacheKey::HashString(TEXT("Location")), TBaseStructure<FVector>::Get(), &Location, FTimespan::Zero()).IsSuccess());
+
+            FVector OutLocation = FVector::ZeroVector;
+            TestTrue("Typed get should succeed", Collection.Get(TEXT("Location"), FHippocacheKey::HashString(TEXT("Location")), TBaseStructure<FVector>::Get(), &OutLocation).IsSuccess());
+            TestEqual("Typed get should return the stored value", OutLocation, Location);
+
+            FInstancedStruct OutValue;
+            TestTrue("FInstancedStruct get should succeed", Collection.Get(TEXT("Location"), OutValue).IsSuccess());
+            TestEqual("FInstancedStruct get should return the stored value", OutValue.Get<FVector>(), Location);
+
+            FRotator OutRotation;
+            TestEqual("Reading as another type should fail", Collection.Get(TEXT("Location"), FHippocacheKey::HashString(TEXT("Location")), TBaseStructure<FRotator>::Get(), &OutRotation).ErrorCode, EHippocacheErrorCode::TypeMismatch);
+
+            // Switching between inline and heap storage under one key
+            FTestStruct HeapValue;
+            HeapValue.IntValue = 5;
+            TestTrue("Overwrite with a heap value should succeed", Collection.Set(TEXT("Location"), FInstancedStruct::Make(HeapValue), FTimespan::Zero()).IsSuccess());
+            TestTrue("Get should succeed", Collection.Get(TEXT("Location"), OutValue).IsSuccess());
+            TestEqual("Heap value should have replaced the inline one", OutValue.Get<FTestStruct>().IntValue, 5);
+            TestTrue("Overwrite with an inline value should succeed", Collection.Set(TEXT("Location"), FInstancedStruct::Make(Location), FTimespan::Zero()).IsSuccess());
+            TestTrue("Get should succeed", Collection.Get(TEXT("Location"), OutValue).IsSuccess());
+            TestEqual("Inline value should have replaced the heap one", OutValue.Get<FVector>(), Location);
+            TestEqual("Only one entry should exist", Collection.Num(), 1);
+        });
+
+        It("should never observe a torn inline value under concurrent overwrites", [this]()
+        {
+            constexpr int32 KeyCount = 8;
+            constexpr int32 WriteCount = 50000;
+            constexpr int32 ReaderCount = 4;
+
+            FHippocacheCollection Collection(TEXT("EpochTest"), 4);
+            std::atomic<bool> bStop { false };
+            std::atomic<int32> TornReads { 0 };
+            std::atomic<int64> SuccessfulReads { 0 };
+
+            TArray<TFuture<void>> Readers;
+            for (int32 ReaderIndex = 0; ReaderIndex < ReaderCount; ++ReaderIndex)
+            {
+                Readers.Add(Async(EAsyncExecution::Thread, [&, ReaderIndex]()
+                {
+                    FVector OutValue;
+                    int32 Iteration = ReaderIndex;
+                    while (!bStop.load(std::memory_order_relaxed))
+                    {
+                        const FString Key = FString::Printf(TEXT("Key_%d"), Iteration++ % KeyCount);
+                        if (Collection.Get(Key, FHippocacheKey::HashString(Key), TBaseStructure<FVector>::Get(), &OutValue).IsSuccess())
+                        {
+                            if (OutValue.X != OutValue.Y || OutValue.Y != OutValue.Z)
+                            {
+                                TornReads.fetch_add(1);
+                            }
+                            SuccessfulReads.fetch_add(1, std::memory_order_relaxed);
+                        }
+                    }
+                }));
+            }
+
+            // Few keys, so nearly every write rewrites a live inline value in place
+            for (int32 i = 0; i < WriteCount; ++i)
+            {
+                const FString Key = FString::Printf(TEXT("Key_%d"), i % KeyCount);
+                const FVector Value(i, i, i);
+                Collection.Set(Key, FHippocacheKey::HashString(Key), TBaseStructure<FVector>::Get(), &Value, FTimespan::Zero());
+            }
+
+            bStop.store(true);
+            for (TFuture<void>& Reader : Readers)
+            {
+                Reader.Wait();
+            }
+
+            TestEqual("Readers should never see a partially written value", TornReads.load(), 0);
+            TestTrue("Readers should have completed some lookups", SuccessfulReads.load() > 0);
+        });
+    });
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
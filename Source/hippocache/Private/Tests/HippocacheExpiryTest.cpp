@@ -0,0 +1,416 @@
+#include "CoreTypes.h"
+#include "Misc/AutomationTest.h"
+#include "HippocacheClock.h"
+#include "HippocacheCollection.h"
+#include "HippocacheExpiryWorker.h"
+#include "HippocacheSubsystem.h"
+#include "HippocacheTimingWheel.h"
+#include "HippocacheWrapperStructs.h"
+#include "Tests/TestStructs.h"
+#include "Runtime/Launch/Resources/Version.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+// ApplicationContextMask is deprecated in UE 5.6+, use conditional compilation for compatibility
+#if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 6
+DEFINE_SPEC(FHippocacheExpirySpec, "Hippocache.Expiry",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+#else
+DEFINE_SPEC(FHippocacheExpirySpec, "Hippocache.Expiry",
+    EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+#endif
+
+void FHippocacheExpirySpec::Define()
+{
+    Describe("Clock", [this]()
+    {
+        It("should turn a TTL into a deadline that passes once the TTL is over", [this]()
+        {
+            const uint64 Now = FHippocacheClock::Now();
+            TestEqual("No TTL should mean no deadline", FHippocacheClock::Deadline(Now, FTimespan::Zero()), FHippocacheClock::Never);
+            TestFalse("No deadline should ever pass", FHippocacheClock::HasPassed(FHippocacheClock::Never, MAX_uint64));
+
+            const uint64 Deadline = FHippocacheClock::Deadline(Now, FTimespan::FromSeconds(2.0));
+            TestEqual("The deadline should be the TTL away", FHippocacheClock::ToSeconds(Deadline - Now), 2.0, 1e-6);
+            TestFalse("The deadline should not have passed at its own time", FHippocacheClock::HasPassed(Deadline, Deadline));
+            TestTrue("The deadline should have passed right after", FHippocacheClock::HasPassed(Deadline, Deadline + 1));
+            TestTrue("Even the shortest TTL should give a deadline", FHippocacheClock::Deadline(Now, FTimespan(1)) > Now);
+
+            const FInt32Wrapper Value(1);
+            FCachedItem Item(FInt32Wrapper::StaticStruct(), &Value, FTimespan::FromSeconds(2.0));
+            TestFalse("A new item should be live", Item.HasExpired());
+            TestTrue("It should expire with its deadline", Item.HasExpired(Item.Deadline + 1));
+        });
+    });
+
+    Describe("Timing Wheel", [this]()
+    {
+        It("should pop records only once they are due, however far out they are", [this]()
+        {
+            const auto ToCycles = [](double Seconds) { return static_cast<uint64>(Seconds / FPlatformTime::GetSecondsPerCycle64()); };
+            const uint64 Start = ToCycles(1000.0);
+            FHippocacheTimingWheel Wheel(Start);
+            // Within level 0, within level 1, an hour out, and past the top level's reach
+            for (const double Delay : { 200000.0, 3600.0, 30.0, 0.5 })
+            {
+                FHippocacheExpiryRecord Record;
+                Record.Deadline = Start + ToCycles(Delay);
+                Wheel.Schedule(MoveTemp(Record));
+            }
+            TestEqual("Every record should be scheduled", Wheel.Num(), 4);
+
+            FHippocacheExpiryRecord Popped;
+            for (const double Delay : { 0.5, 30.0, 3600.0, 200000.0 })
+            {
+                TestFalse(FString::Printf(TEXT("Nothing should be due just before %.1f seconds"), Delay), Wheel.PopDue(Start + ToCycles(Delay - 0.05), Popped));
+                TestTrue(FString::Printf(TEXT("The record should be due just after %.1f seconds"), Delay), Wheel.PopDue(Start + ToCycles(Delay + 0.05), Popped));
+                TestEqual(FString::Printf(TEXT("The %.1f second record should come out"), Delay), Popped.Deadline, Start + ToCycles(Delay));
+            }
+            TestFalse("Nothing should be left", Wheel.PopDue(Start + ToCycles(300000.0), Popped));
+            TestEqual("The wheel should be empty", Wheel.Num(), 0);
+        });
+
+        It("should pop records scheduled in the past right away", [this]()
+        {
+            const uint64 Start = FHippocacheClock::Now();
+            const uint64 Later = Start + static_cast<uint64>(10.0 / FPlatformTime::GetSecondsPerCycle64());
+            FHippocacheTimingWheel Wheel(Start);
+            FHippocacheExpiryRecord Popped;
+            TestFalse("An empty wheel should have nothing due", Wheel.PopDue(Later, Popped));
+
+            FHippocacheExpiryRecord Record;
+            Record.Deadline = Start / 2;
+            Record.Hash = 42;
+            Wheel.Schedule(MoveTemp(Record));
+            TestTrue("A record that expired before it was scheduled should be due", Wheel.PopDue(Later, Popped));
+            TestEqual("It should keep its hash", Popped.Hash, uint64(42));
+        });
+    });
+
+    Describe("Expired Reads", [this]()
+    {
+        It("should leave expired items for the next writer to remove in every collection layout", [this]()
+        {
+            FHippocacheCollection FlatCollection(TEXT("Flat"), 1);
+            FHippocacheCollection MapCollection(TEXT("Map"), 1, EHippocacheIndexType::TMap);
+            FHippocacheCollection TypedCollection(TEXT("Typed"), 1, EHippocacheIndexType::FlatTable, EHippocacheValueAllocator::Heap, FInt32Wrapper::StaticStruct());
+
+            for (FHippocacheCollection* Collection : { &FlatCollection, &MapCollection, &TypedCollection })
+            {
+                const FString Name = Collection->GetName().ToString();
+                Collection->Set(TEXT("Expiring"), FInstancedStruct::Make(FInt32Wrapper(1)), FTimespan::FromMilliseconds(1.0));
+                FPlatformProcess::Sleep(0.01f);
+
+                FInstancedStruct OutValue;
+                for (int32 Read = 0; Read < 3; ++Read)
+                {
+                    TestEqual(FString::Printf(TEXT("%s: The read should see the item expired"), *Name), Collection->Get(TEXT("Expiring"), OutValue).ErrorCode, EHippocacheErrorCode::ItemExpired);
+                }
+                TestEqual(FString::Printf(TEXT("%s: A read should not remove the item itself"), *Name), Collection->Num(), 1);
+
+                Collection->Set(TEXT("Other"), FInstancedStruct::Make(FInt32Wrapper(2)), FTimespan::Zero());
+                TestEqual(FString::Printf(TEXT("%s: The next write should remove the expired item"), *Name), Collection->Num(), 1);
+                TestEqual(FString::Printf(TEXT("%s: The expired item should be gone"), *Name), Collection->Get(TEXT("Expiring"), OutValue).ErrorCode, EHippocacheErrorCode::ItemNotFound);
+            }
+        });
+
+        It("should not remove an item rewritten after the expired read", [this]()
+        {
+            FHippocacheCollection Collection(TEXT("Flat"), 1);
+            Collection.Set(TEXT("Key"), FInstancedStruct::Make(FInt32Wrapper(1)), FTimespan::FromMilliseconds(1.0));
+            FPlatformProcess::Sleep(0.01f);
+
+            FInstancedStruct OutValue;
+            TestEqual("The read should see the item expired", Collection.Get(TEXT("Key"), OutValue).ErrorCode, EHippocacheErrorCode::ItemExpired);
+            Collection.Set(TEXT("Key"), FInstancedStruct::Make(FInt32Wrapper(2)), FTimespan::Zero());
+            Collection.Set(TEXT("Other"), FInstancedStruct::Make(FInt32Wrapper(3)), FTimespan::Zero());
+
+            TestTrue("The rewritten item should stay", Collection.Get(TEXT("Key"), OutValue).IsSuccess());
+            TestEqual("It should hold the new value", OutValue.Get<FInt32Wrapper>().Value, 2);
+        });
+
+        It("should start queueing afresh after a full queue is cleared, and drain it on Remove", [this]()
+        {
+            FHippocacheCollection FlatCollection(TEXT("Flat"), 1);
+            FHippocacheCollection MapCollection(TEXT("Map"), 1, EHippocacheIndexType::TMap);
+            FHippocacheCollection TypedCollection(TEXT("Typed"), 1, EHippocacheIndexType::FlatTable, EHippocacheValueAllocator::Heap, FInt32Wrapper::StaticStruct());
+
+            for (FHippocacheCollection* Collection : { &FlatCollection, &MapCollection, &TypedCollection })
+            {
+                const FString Name = Collection->GetName().ToString();
+                FInstancedStruct OutValue;
+
+                // More expired reads than a shard queues, so the queue is full when it is cleared
+                for (int32 Index = 0; Index < 300; ++Index)
+                {
+                    Collection->Set(FString::Printf(TEXT("Old%d"), Index), FInstancedStruct::Make(FInt32Wrapper(Index)), FTimespan::FromMilliseconds(1.0));
+                }
+                FPlatformProcess::Sleep(0.01f);
+                for (int32 Index = 0; Index < 300; ++Index)
+                {
+                    Collection->Get(FString::Printf(TEXT("Old%d"), Index), OutValue);
+                }
+                TestEqual(FString::Printf(TEXT("%s: Clear should report every item"), *Name), Collection->Clear(), 300);
+
+                for (int32 Index = 0; Index < 10; ++Index)
+                {
+                    Collection->Set(FString::Printf(TEXT("New%d"), Index), FInstancedStruct::Make(FInt32Wrapper(Index)), FTimespan::FromMilliseconds(1.0));
+                }
+                FPlatformProcess::Sleep(0.01f);
+                for (int32 Index = 0; Index < 10; ++Index)
+                {
+                    TestEqual(FString::Printf(TEXT("%s: The read should see the item expired"), *Name), Collection->Get(FString::Printf(TEXT("New%d"), Index), OutValue).ErrorCode, EHippocacheErrorCode::ItemExpired);
+                }
+                TestEqual(FString::Printf(TEXT("%s: Reads should not remove the items themselves"), *Name), Collection->Num(), 10);
+
+                TestEqual(FString::Printf(TEXT("%s: Removing a missing key should still fail"), *Name), Collection->Remove(TEXT("Missing")).ErrorCode, EHippocacheErrorCode::ItemNotFound);
+                TestEqual(FString::Printf(TEXT("%s: Remove should remove the items the reads queued"), *Name), Collection->Num(), 0);
+            }
+        });
+    });
+
+    Describe("Incremental Sweep", [this]()
+    {
+        It("should remove expired items a slice at a time in every collection layout", [this]()
+        {
+            const int32 NumExpiring = 200;
+            const int32 NumLive = 50;
+            const int32 ItemsPerStep = 16;
+
+            FHippocacheCollection FlatCollection(TEXT("Flat"), 4);
+            FHippocacheCollection MapCollection(TEXT("Map"), 4, EHippocacheIndexType::TMap);
+            FHippocacheCollection TypedCollection(TEXT("Typed"), 4, EHippocacheIndexType::FlatTable, EHippocacheValueAllocator::Heap, FInt32Wrapper::StaticStruct());
+
+            for (FHippocacheCollection* Collection : { &FlatCollection, &MapCollection, &TypedCollection })
+            {
+                for (int32 Index = 0; Index < NumExpiring + NumLive; ++Index)
+                {
+                    const FTimespan TTL = Index < NumExpiring ? FTimespan::FromMilliseconds(1.0) : FTimespan::Zero();
+                    Collection->Set(FString::Printf(TEXT("Key%d"), Index), FInstancedStruct::Make(FInt32Wrapper(Index)), TTL);
+                }
+            }
+            FPlatformProcess::Sleep(0.05f);
+
+            for (FHippocacheCollection* Collection : { &FlatCollection, &MapCollection, &TypedCollection })
+            {
+                const FString Name = Collection->GetName().ToString();
+                FHippocacheSweepStats Total;
+                int32 Steps = 0;
+                bool bFinished = false;
+                while (!bFinished && Steps < 10000)
+                {
+                    FHippocacheSweepBudget Budget;
+                    Budget.ItemsLeft = ItemsPerStep;
+                    Budget.EndTime = FPlatformTime::Seconds() + 10.0;
+                    Budget.MaxLockSeconds = 10.0;
+
+                    FHippocacheSweepStats Stats;
+                    bFinished = Collection->SweepExpired(Budget, Stats);
+                    TestTrue(FString::Printf(TEXT("%s: A step should stay within its item budget"), *Name), Stats.ItemsExamined <= ItemsPerStep);
+                    Total.ItemsRemoved += Stats.ItemsRemoved;
+                    ++Steps;
+                }
+
+                TestTrue(FString::Printf(TEXT("%s: The sweep should finish a pass"), *Name), bFinished);
+                TestTrue(FString::Printf(TEXT("%s: The pass should take several steps"), *Name), Steps > 1);
+                TestEqual(FString::Printf(TEXT("%s: Every expired item should be removed"), *Name), Total.ItemsRemoved, NumExpiring);
+                TestEqual(FString::Printf(TEXT("%s: Live items should stay"), *Name), Collection->Num(), NumLive);
+            }
+        });
+
+        It("should stop at its time budget and resume where it stopped", [this]()
+        {
+            FHippocacheCollection Collection(TEXT("Flat"), 1);
+            for (int32 Index = 0; Index < 100; ++Index)
+            {
+                Collection.Set(FString::Printf(TEXT("Key%d"), Index), FInstancedStruct::Make(FInt32Wrapper(Index)), FTimespan::FromMilliseconds(1.0));
+            }
+            FPlatformProcess::Sleep(0.05f);
+
+            // An exhausted time budget examines nothing
+            FHippocacheSweepBudget Budget;
+            Budget.ItemsLeft = MAX_int32;
+            Budget.EndTime = FPlatformTime::Seconds() - 1.0;
+            FHippocacheSweepStats Stats;
+            TestFalse("A step without time should not finish", Collection.SweepExpired(Budget, Stats));
+            TestEqual("A step without time should examine nothing", Stats.ItemsExamined, 0);
+
+            Budget.EndTime = FPlatformTime::Seconds() + 10.0;
+            Budget.MaxLockSeconds = 10.0;
+            TestTrue("A step with time should finish", Collection.SweepExpired(Budget, Stats));
+            TestEqual("Every item should be removed", Collection.Num(), 0);
+            TestEqual("The lock should be taken once", Stats.LockHolds, 1);
+        });
+
+        It("should remove an item updated in place of its old entry", [this]()
+        {
+            // FTestStruct isn't stored inline, so a flat table update replaces the item's entry
+            FHippocacheCollection Collection(TEXT("Flat"), 1);
+            FTestStruct Value;
+            Value.IntValue = 1;
+            Collection.Set(TEXT("Key"), FInstancedStruct::Make(Value), FTimespan::FromMilliseconds(20.0));
+            TestTrue("The update should succeed", Collection.Update(TEXT("Key"), FHippocacheKey::HashString(TEXT("Key")), FTestStruct::StaticStruct(), [](const UScriptStruct*, void* Memory)
+            {
+                static_cast<FTestStruct*>(Memory)->IntValue = 2;
+            }).IsSuccess());
+            FPlatformProcess::Sleep(0.05f);
+
+            FHippocacheSweepBudget Budget;
+            Budget.ItemsLeft = MAX_int32;
+            Budget.EndTime = FPlatformTime::Seconds() + 10.0;
+            Budget.MaxLockSeconds = 10.0;
+            FHippocacheSweepStats Stats;
+            TestTrue("The sweep should finish", Collection.SweepExpired(Budget, Stats));
+            TestEqual("The sweep should remove the updated item", Stats.ItemsRemoved, 1);
+            TestEqual("The collection should be empty", Collection.Num(), 0);
+        });
+
+        It("should keep one record per item however often it is rewritten", [this]()
+        {
+            FHippocacheCollection FlatCollection(TEXT("Flat"), 1);
+            FHippocacheCollection MapCollection(TEXT("Map"), 1, EHippocacheIndexType::TMap);
+            FHippocacheCollection TypedCollection(TEXT("Typed"), 1, EHippocacheIndexType::FlatTable, EHippocacheValueAllocator::Heap, FInt32Wrapper::StaticStruct());
+
+            const auto Sweep = [](FHippocacheCollection& Collection)
+            {
+                FHippocacheSweepBudget Budget;
+                Budget.ItemsLeft = MAX_int32;
+                Budget.EndTime = FPlatformTime::Seconds() + 10.0;
+                Budget.MaxLockSeconds = 10.0;
+                FHippocacheSweepStats Stats;
+                Collection.SweepExpired(Budget, Stats);
+                return Stats;
+            };
+
+            for (FHippocacheCollection* Collection : { &FlatCollection, &MapCollection, &TypedCollection })
+            {
+                // Each rewrite pushes the deadline out, so the first record still comes due first
+                for (int32 Index = 0; Index < 100; ++Index)
+                {
+                    Collection->Set(TEXT("Key"), FInstancedStruct::Make(FInt32Wrapper(Index)), FTimespan::FromMilliseconds(10.0));
+                }
+                Collection->Set(TEXT("Key"), FInstancedStruct::Make(FInt32Wrapper(100)), FTimespan::FromMilliseconds(100.0));
+
+                // An earlier deadline than the record's needs a record of its own
+                Collection->Set(TEXT("Short"), FInstancedStruct::Make(FInt32Wrapper(0)), FTimespan::FromSeconds(60.0));
+                Collection->Set(TEXT("Short"), FInstancedStruct::Make(FInt32Wrapper(1)), FTimespan::FromMilliseconds(10.0));
+            }
+            FPlatformProcess::Sleep(0.04f);
+
+            for (FHippocacheCollection* Collection : { &FlatCollection, &MapCollection, &TypedCollection })
+            {
+                const FString Name = Collection->GetName().ToString();
+                FHippocacheSweepStats Stats = Sweep(*Collection);
+                TestEqual(FString::Printf(TEXT("%s: Only the first record of each key should be due"), *Name), Stats.ItemsExamined, 2);
+                TestEqual(FString::Printf(TEXT("%s: Only the shortened item should be removed"), *Name), Stats.ItemsRemoved, 1);
+                TestEqual(FString::Printf(TEXT("%s: The rewritten item should stay"), *Name), Collection->Num(), 1);
+            }
+            FPlatformProcess::Sleep(0.1f);
+
+            for (FHippocacheCollection* Collection : { &FlatCollection, &MapCollection, &TypedCollection })
+            {
+                const FString Name = Collection->GetName().ToString();
+                FHippocacheSweepStats Stats = Sweep(*Collection);
+                TestEqual(FString::Printf(TEXT("%s: The record should come due again at the new deadline"), *Name), Stats.ItemsExamined, 1);
+                TestEqual(FString::Printf(TEXT("%s: The rewritten item should be removed then"), *Name), Stats.ItemsRemoved, 1);
+                TestEqual(FString::Printf(TEXT("%s: The collection should be empty"), *Name), Collection->Num(), 0);
+            }
+        });
+
+        It("should sweep every collection of a subsystem and keep the stats", [this]()
+        {
+            UHippocacheSubsystem* Subsystem = NewObject<UHippocacheSubsystem>();
+            for (const FName Collection : { FName(TEXT("First")), FName(TEXT("Second")) })
+            {
+                for (int32 Index = 0; Index < 20; ++Index)
+                {
+                    Subsystem->SetStructWithTTL(Collection, FString::Printf(TEXT("Key%d"), Index), FInt32Wrapper(Index), FTimespan::FromMilliseconds(1.0));
+                }
+                Subsystem->SetStruct(Collection, TEXT("Live"), FInt32Wrapper(1));
+            }
+            FPlatformProcess::Sleep(0.05f);
+
+            int32 Removed = 0;
+            int32 Completed = 0;
+            for (int32 Step = 0; Step < 1000 && Completed < 2; ++Step)
+            {
+                const FHippocacheSweepStats Stats = Subsystem->SweepExpired(8, 10.0);
+                TestEqual("The last stats should be the step's", Subsystem->GetLastSweepStats().ItemsExamined, Stats.ItemsExamined);
+                Removed += Stats.ItemsRemoved;
+                Completed += Stats.CollectionsCompleted;
+            }
+
+            TestEqual("Both collections should be swept", Completed, 2);
+            TestEqual("Every expired item should be removed", Removed, 40);
+            int32 Count = 0;
+            Subsystem->Num(TEXT("First"), Count);
+            TestEqual("The live item should stay", Count, 1);
+        });
+    });
+
+    Describe("Expiry Worker", [this]()
+    {
+        It("should run its step on another thread until it is destroyed", [this]()
+        {
+            if (!FPlatformProcess::SupportsMultithreading())
+            {
+                return;
+            }
+
+            std::atomic<int32> Steps { 0 };
+            std::atomic<bool> bOffGameThread { true };
+            {
+                FHippocacheExpiryWorker Worker([&Steps, &bOffGameThread]()
+                {
+                    if (IsInGameThread())
+                    {
+                        bOffGameThread = false;
+                    }
+                    ++Steps;
+                }, 0.01f);
+
+                for (int32 Wait = 0; Wait < 500 && Steps.load() < 3; ++Wait)
+                {
+                    FPlatformProcess::Sleep(0.01f);
+                }
+            }
+            const int32 StepsWhenStopped = Steps.load();
+
+            TestTrue("The worker should have stepped repeatedly", StepsWhenStopped >= 3);
+            TestTrue("The steps should run off the game thread", bOffGameThread.load());
+            FPlatformProcess::Sleep(0.05f);
+            TestEqual("No step should run after the worker is destroyed", Steps.load(), StepsWhenStopped);
+        });
+
+        It("should sweep a subsystem's expired items from its thread", [this]()
+        {
+            if (!FPlatformProcess::SupportsMultithreading())
+            {
+                return;
+            }
+
+            UHippocacheSubsystem* Subsystem = NewObject<UHippocacheSubsystem>();
+            for (int32 Index = 0; Index < 20; ++Index)
+            {
+                Subsystem->SetStructWithTTL(TEXT("Worker"), FString::Printf(TEXT("Key%d"), Index), FInt32Wrapper(Index), FTimespan::FromMilliseconds(1.0));
+            }
+
+            int32 Count = 0;
+            {
+                FHippocacheExpiryWorker Worker([Subsystem]() { Subsystem->SweepExpired(MAX_int32, 10.0); }, 0.01f);
+                for (int32 Wait = 0; Wait < 500; ++Wait)
+                {
+                    FPlatformProcess::Sleep(0.01f);
+                    Subsystem->Num(TEXT("Worker"), Count);
+                    if (Count == 0)
+                    {
+                        break;
+                    }
+                }
+            }
+            TestEqual("The worker should remove every expired item", Count, 0);
+        });
+    });
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
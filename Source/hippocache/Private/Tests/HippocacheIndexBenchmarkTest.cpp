@@ -0,0 +1,141 @@
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "Async/Async.h"
+#include "HAL/PlatformTime.h"
+#include "HippocacheSubsystem.h"
+#include "Runtime/Launch/Resources/Version.h"
+#include "Tests/TestStructs.h"
+
+#include <atomic>
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+// ApplicationContextMask is deprecated in UE 5.6+, use conditional compilation for compatibility
+#if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 6
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FHippocacheIndexBenchmarkTest, "Hippocache.Performance.IndexType",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter | EAutomationTestFlags::HighPriority)
+#else
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FHippocacheIndexBenchmarkTest, "Hippocache.Performance.IndexType",
+    EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter | EAutomationTestFlags::HighPriority)
+#endif
+
+namespace HippocacheIndexBenchmark
+{
+    constexpr int32 KeyCount = 10000;
+    constexpr int32 LookupCount = 200000;
+    constexpr int32 ReaderThreads = 4;
+
+    struct FIndexBenchmarkResult
+    {
+        double SetOpsPerSecond = 0.0;
+        double HitOpsPerSecond = 0.0;
+        double MissOpsPerSecond = 0.0;
+        double ParallelReadOpsPerSecond = 0.0;
+    };
+
+    FIndexBenchmarkResult Run(UHippocacheSubsystem* Subsystem, FName Collection, const TArray<FString>& Keys, const TArray<FString>& MissingKeys)
+    {
+        FIndexBenchmarkResult Result;
+
+        FTestStruct Value;
+        Value.StringValue = TEXT("IndexBenchmark");
+        const FInstancedStruct InstancedValue = FInstancedStruct::Make(Value);
+
+        double StartTime = FPlatformTime::Seconds();
+        for (const FString& Key : Keys)
+        {
+            Subsystem->SetStruct(Collection, Key, InstancedValue);
+        }
+        Result.SetOpsPerSecond = Keys.Num() / (FPlatformTime::Seconds() - StartTime);
+
+        FInstancedStruct OutValue;
+        StartTime = FPlatformTime::Seconds();
+        for (int32 i = 0; i < LookupCount; ++i)
+        {
+            Subsystem->GetStruct(Collection, Keys[i % Keys.Num()], OutValue);
+        }
+        Result.HitOpsPerSecond = LookupCount / (FPlatformTime::Seconds() - StartTime);
+
+        StartTime = FPlatformTime::Seconds();
+        for (int32 i = 0; i < LookupCount; ++i)
+        {
+            Subsystem->GetStruct(Collection, MissingKeys[i % MissingKeys.Num()], OutValue);
+        }
+        Result.MissOpsPerSecond = LookupCount / (FPlatformTime::Seconds() - StartTime);
+
+        // Parallel readers, where lock traffic on the shard shows up
+        std::atomic<int64> TotalReads { 0 };
+        TArray<TFuture<void>> Readers;
+        StartTime = FPlatformTime::Seconds();
+        for (int32 ReaderIndex = 0; ReaderIndex < ReaderThreads; ++ReaderIndex)
+        {
+            Readers.Add(Async(EAsyncExecution::Thread, [&, ReaderIndex]()
+            {
+                FInstancedStruct ThreadValue;
+                for (int32 i = 0; i < LookupCount; ++i)
+                {
+                    Subsystem->GetStruct(Collection, Keys[(i + ReaderIndex * 1009) % Keys.Num()], ThreadValue);
+                }
+                TotalReads.fetch_add(LookupCount, std::memory_order_relaxed);
+            }));
+        }
+        for (TFuture<void>& Reader : Readers)
+        {
+            Reader.Wait();
+        }
+        Result.ParallelReadOpsPerSecond = TotalReads.load() / (FPlatformTime::Seconds() - StartTime);
+
+        return Result;
+    }
+}
+
+bool FHippocacheIndexBenchmarkTest::RunTest(const FString& Parameters)
+{
+    using namespace HippocacheIndexBenchmark;
+
+    UHippocacheSubsystem* Subsystem = NewObject<UHippocacheSubsystem>();
+    if (!TestNotNull(TEXT("Subsystem should be created"), Subsystem))
+    {
+        return false;
+    }
+
+    TArray<FString> Keys;
+    TArray<FString> MissingKeys;
+    Keys.Reserve(KeyCount);
+    MissingKeys.Reserve(KeyCount);
+    for (int32 i = 0; i < KeyCount; ++i)
+    {
+        Keys.Add(FString::Printf(TEXT("Entity_%d_Position"), i));
+        MissingKeys.Add(FString::Printf(TEXT("Entity_%d_Missing"), i));
+    }
+
+    AddInfo(TEXT("=== Hippocache Index Type Benchmark ==="));
+    AddInfo(FString::Printf(TEXT("Keys: %d, lookups per pass: %d, parallel readers: %d"), KeyCount, LookupCount, ReaderThreads));
+
+    const EHippocacheIndexType IndexTypes[] = { EHippocacheIndexType::FlatTable, EHippocacheIndexType::TMap };
+    for (const EHippocacheIndexType IndexType : IndexTypes)
+    {
+        const FString TypeName = UEnum::GetValueAsString(IndexType);
+        const FName Collection = *FString::Printf(TEXT("IndexBench_%s"), *TypeName);
+
+        FHippocacheCollectionOptions Options;
+        Options.IndexType = IndexType;
+        TestTrue(FString::Printf(TEXT("%s collection should be created"), *TypeName), Subsystem->CreateCollection(Collection, Options).IsSuccess());
+
+        const FIndexBenchmarkResult Result = Run(Subsystem, Collection, Keys, MissingKeys);
+
+        AddInfo(FString::Printf(TEXT("=== %s ==="), *TypeName));
+        AddInfo(FString::Printf(TEXT("Set: %.2f ops/sec"), Result.SetOpsPerSecond));
+        AddInfo(FString::Printf(TEXT("Get (hit): %.2f ops/sec"), Result.HitOpsPerSecond));
+        AddInfo(FString::Printf(TEXT("Get (miss): %.2f ops/sec"), Result.MissOpsPerSecond));
+        AddInfo(FString::Printf(TEXT("Get (hit, %d threads): %.2f ops/sec"), ReaderThreads, Result.ParallelReadOpsPerSecond));
+
+        int32 Count = 0;
+        Subsystem->Num(Collection, Count);
+        TestEqual(FString::Printf(TEXT("%s collection should hold every key"), *TypeName), Count, KeyCount);
+    }
+
+    return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
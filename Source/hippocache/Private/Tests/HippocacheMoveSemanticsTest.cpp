@@ -0,0 +1,127 @@
+#include "CoreTypes.h"
+#include "Misc/AutomationTest.h"
+#include "HippocacheSubsystem.h"
+#include "Runtime/Launch/Resources/Version.h"
+#include "Tests/TestStructs.h"
+#include "Tests/WeirdTestStructs.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+// ApplicationContextMask is deprecated in UE 5.6+, use conditional compilation for compatibility
+#if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 6
+DEFINE_SPEC(FHippocacheMoveSemanticsSpec, "Hippocache.MoveSemantics",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+#else
+DEFINE_SPEC(FHippocacheMoveSemanticsSpec, "Hippocache.MoveSemantics",
+    EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+#endif
+
+void FHippocacheMoveSemanticsSpec::Define()
+{
+    Describe("Rvalue Set", [this]()
+    {
+        It("should move a large struct into the cache instead of copying it", [this]()
+        {
+            UHippocacheSubsystem* Subsystem = NewObject<UHippocacheSubsystem>();
+            FHugeStruct Value;
+            const int32* ArrayData = Value.MassiveArray.GetData();
+            const int32 ArrayNum = Value.MassiveArray.Num();
+
+            TestTrue("Set should succeed", Subsystem->SetStruct(TEXT("MoveTest"), TEXT("Huge"), MoveTemp(Value)).IsSuccess());
+            TestEqual("The source should have been moved from", Value.MassiveArray.Num(), 0);
+
+            const int32* CachedArrayData = nullptr;
+            Subsystem->ReadStructTyped<FHugeStruct>(TEXT("MoveTest"), TEXT("Huge"), [&](const FHugeStruct& View)
+            {
+                TestEqual("The cached array should be intact", View.MassiveArray.Num(), ArrayNum);
+                CachedArrayData = View.MassiveArray.GetData();
+            });
+            TestEqual("The cached value should own the original array", CachedArrayData, ArrayData);
+        });
+
+        It("should take over an FInstancedStruct's allocation", [this]()
+        {
+            UHippocacheSubsystem* Subsystem = NewObject<UHippocacheSubsystem>();
+            FTestStruct Value;
+            Value.StringValue = TEXT("Adopted");
+            FInstancedStruct Instanced = FInstancedStruct::Make(Value);
+            const uint8* Memory = Instanced.GetMemory();
+
+            TestTrue("Set should succeed", Subsystem->SetStruct(TEXT("MoveTest"), FHippocacheKey(TEXT("Key")), MoveTemp(Instanced)).IsSuccess());
+            TestFalse("The source should be left empty", Instanced.IsValid());
+
+            const uint8* CachedMemory = nullptr;
+            Subsystem->ReadStruct(TEXT("MoveTest"), TEXT("Key"), [&](FConstStructView View)
+            {
+                CachedMemory = View.GetMemory();
+            });
+            TestEqual("The cached value should be the original allocation", CachedMemory, Memory);
+            TestEqual("Value should round-trip", Subsystem->GetStructTyped<FTestStruct>(TEXT("MoveTest"), TEXT("Key")).Value.StringValue, FString(TEXT("Adopted")));
+        });
+
+        It("should move into every collection layout", [this]()
+        {
+            UHippocacheSubsystem* Subsystem = NewObject<UHippocacheSubsystem>();
+            FHippocacheCollectionOptions MapOptions;
+            MapOptions.IndexType = EHippocacheIndexType::TMap;
+            Subsystem->CreateCollection(TEXT("Map"), MapOptions);
+            FHippocacheCollectionOptions SlabOptions;
+            SlabOptions.ValueAllocator = EHippocacheValueAllocator::Slab;
+            Subsystem->CreateCollection(TEXT("Slab"), SlabOptions);
+            Subsystem->CreateTypedCollection<FTestStruct>(TEXT("Typed"));
+
+            for (const FName Collection : { FName(TEXT("Flat")), FName(TEXT("Map")), FName(TEXT("Slab")), FName(TEXT("Typed")) })
+            {
+                // Overwrite with the same type too, which rebuilds the value where it already lives
+                for (int32 Round = 0; Round < 2; ++Round)
+                {
+                    FTestStruct Value;
+                    Value.IntValue = Round;
+                    Value.StringValue = FString::Printf(TEXT("Round_%d"), Round);
+                    TestTrue("Set should succeed", Subsystem->SetStruct(Collection, TEXT("Key"), MoveTemp(Value)).IsSuccess());
+                    TestTrue("The source string should have been moved from", Value.StringValue.IsEmpty());
+                }
+
+                THippocacheResult<FTestStruct> Result = Subsystem->GetStructTyped<FTestStruct>(Collection, TEXT("Key"));
+                TestEqual(FString::Printf(TEXT("%s should hold the last value"), *Collection.ToString()), Result.Value.StringValue, FString(TEXT("Round_1")));
+            }
+        });
+
+        It("should leave the value untouched when the Set fails", [this]()
+        {
+            UHippocacheSubsystem* Subsystem = NewObject<UHippocacheSubsystem>();
+            Subsystem->CreateTypedCollection<FHugeStruct>(TEXT("Typed"));
+
+            FTestStruct Value;
+            Value.StringValue = TEXT("Kept");
+            TestEqual("Wrong type should fail", Subsystem->SetStruct(TEXT("Typed"), TEXT("Key"), MoveTemp(Value)).ErrorCode, EHippocacheErrorCode::TypeMismatch);
+            TestEqual("The value should not have been moved from", Value.StringValue, FString(TEXT("Kept")));
+        });
+    });
+
+    Describe("Emplace", [this]()
+    {
+        It("should construct the value in the cache from its arguments", [this]()
+        {
+            UHippocacheSubsystem* Subsystem = NewObject<UHippocacheSubsystem>();
+            FTestStruct Source;
+            Source.IntValue = 9;
+            Source.StringValue = TEXT("Emplaced");
+
+            TestTrue("EmplaceStruct should succeed", Subsystem->EmplaceStruct<FTestStruct>(TEXT("EmplaceTest"), TEXT("Copy"), Source).IsSuccess());
+            TestTrue("EmplaceStruct should succeed", Subsystem->EmplaceStruct<FTestStruct>(TEXT("EmplaceTest"), FHippocacheKey(TEXT("Move")), MoveTemp(Source)).IsSuccess());
+            TestTrue("The moved argument should have been moved from", Source.StringValue.IsEmpty());
+
+            TestEqual("Copy-constructed value should match", Subsystem->GetStructTyped<FTestStruct>(TEXT("EmplaceTest"), TEXT("Copy")).Value.IntValue, 9);
+            TestEqual("Move-constructed value should match", Subsystem->GetStructTyped<FTestStruct>(TEXT("EmplaceTest"), TEXT("Move")).Value.StringValue, FString(TEXT("Emplaced")));
+
+            TestTrue("Default construction should succeed", Subsystem->EmplaceStructWithTTL<FHugeStruct>(TEXT("EmplaceTest"), TEXT("Huge"), FTimespan::FromMinutes(1.0)).IsSuccess());
+            Subsystem->ReadStructTyped<FHugeStruct>(TEXT("EmplaceTest"), TEXT("Huge"), [this](const FHugeStruct& View)
+            {
+                TestEqual("Default-constructed value should be complete", View.MassiveArray.Num(), 1000);
+            });
+        });
+    });
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,199 @@
+#include "CoreTypes.h"
+#include "Misc/AutomationTest.h"
+#include "Async/Async.h"
+#include "HippocacheBlueprintLibrary.h"
+#include "HippocacheEpoch.h"
+#include "HippocachePropertyValue.h"
+#include "HippocacheSubsystem.h"
+#include "Runtime/Launch/Resources/Version.h"
+#include "Tests/TestStructs.h"
+#include "Tests/WeirdTestStructs.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+// ApplicationContextMask is deprecated in UE 5.6+, use conditional compilation for compatibility
+#if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 6
+DEFINE_SPEC(FHippocacheReadStructSpec, "Hippocache.ReadStruct",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+#else
+DEFINE_SPEC(FHippocacheReadStructSpec, "Hippocache.ReadStruct",
+    EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+#endif
+
+void FHippocacheReadStructSpec::Define()
+{
+    Describe("In-place Reads", [this]()
+    {
+        It("should view a large struct without copying it", [this]()
+        {
+            UHippocacheSubsystem* Subsystem = NewObject<UHippocacheSubsystem>();
+            const FHugeStruct Value;
+            Subsystem->SetStruct(TEXT("ReadTest"), TEXT("Config"), FInstancedStruct::Make(Value));
+
+            const int32* FirstViewedElement = nullptr;
+            int32 ViewedCount = 0;
+            TestTrue("ReadStructTyped should succeed", Subsystem->ReadStructTyped<FHugeStruct>(TEXT("ReadTest"), TEXT("Config"), [&](const FHugeStruct& View)
+            {
+                FirstViewedElement = View.MassiveArray.GetData();
+                ViewedCount = View.MassiveArray.Num();
+            }).IsSuccess());
+            TestEqual("View should see the stored array", ViewedCount, Value.MassiveArray.Num());
+
+            // A second read must see the very same storage: nothing was copied
+            const int32* SecondViewedElement = nullptr;
+            Subsystem->ReadStruct(TEXT("ReadTest"), FHippocacheKey(TEXT("Config")), [&](FConstStructView View)
+            {
+                SecondViewedElement = View.Get<FHugeStruct>().MassiveArray.GetData();
+            });
+            TestEqual("Both reads should view the cached value itself", SecondViewedElement, FirstViewedElement);
+        });
+
+        It("should report errors without calling the visitor", [this]()
+        {
+            UHippocacheSubsystem* Subsystem = NewObject<UHippocacheSubsystem>();
+            FTestStruct Value;
+            Subsystem->SetStruct(TEXT("ReadTest"), TEXT("Key"), Value);
+
+            bool bVisited = false;
+            TestEqual("Missing key should fail", Subsystem->ReadStruct(TEXT("ReadTest"), TEXT("Missing"), [&bVisited](FConstStructView View) { bVisited = true; }).ErrorCode, EHippocacheErrorCode::ItemNotFound);
+            TestEqual("Wrong type should fail", Subsystem->ReadStructTyped<FHugeStruct>(TEXT("ReadTest"), TEXT("Key"), [&bVisited](const FHugeStruct& View) { bVisited = true; }).ErrorCode, EHippocacheErrorCode::TypeMismatch);
+            TestFalse("Visitor should not run on failure", bVisited);
+        });
+
+        It("should describe misses only when asked", [this]()
+        {
+            UHippocacheSubsystem* Subsystem = NewObject<UHippocacheSubsystem>();
+            FTestStruct Value;
+            Subsystem->SetStruct(TEXT("ReadTest"), TEXT("Key"), Value);
+
+            THippocacheResult<FTestStruct> Miss = Subsystem->GetStructTyped<FTestStruct>(TEXT("ReadTest"), TEXT("Missing"));
+            TestEqual("Missing key should fail", Miss.Result.ErrorCode, EHippocacheErrorCode::ItemNotFound);
+            TestEqual("The message should be formatted on request", Miss.Result.GetErrorMessage(), FString(TEXT("Item not found")));
+            TestEqual("The context should be formatted on request", Miss.Result.GetErrorContext(), FString(TEXT("Collection: ReadTest, Key: Missing")));
+
+            TestTrue("Copying a miss should not format it", FHippocacheResult(Miss.Result).ErrorMessage.IsEmpty());
+
+            // Blueprint's Break node goes through the accessors
+            EHippocacheErrorCode ErrorCode;
+            FString ErrorMessage;
+            FString ErrorContext;
+            UHippocacheBlueprintLibrary::BreakHippocacheResult(Miss.Result, ErrorCode, ErrorMessage, ErrorContext);
+            TestEqual("Breaking should give the code", ErrorCode, EHippocacheErrorCode::ItemNotFound);
+            TestEqual("Breaking should give the message", ErrorMessage, FString(TEXT("Item not found")));
+            TestEqual("Breaking should give the context", ErrorContext, FString(TEXT("Collection: ReadTest, Key: Missing")));
+
+            FHippocacheResult Described = Miss.Result;
+            Described.Describe();
+            TestEqual("Describing should fill the message", Described.ErrorMessage, FString(TEXT("Item not found")));
+            TestEqual("Describing should fill the context", Described.ErrorContext, FString(TEXT("Collection: ReadTest, Key: Missing")));
+
+            const FString FullKey = FString::ChrN(FHippocacheResult::InlineKeyLength, TEXT('f'));
+            TestEqual("A key that fits should be shown in full", Subsystem->GetStructTyped<FTestStruct>(TEXT("ReadTest"), FullKey).Result.GetErrorContext(), FString::Printf(TEXT("Collection: ReadTest, Key: %s"), *FullKey));
+
+            const FString LongKey = FString::ChrN(256, TEXT('k'));
+            const FString LongContext = FString::Printf(TEXT("Collection: ReadTest, Key: %s... (hash %016llx)"), *LongKey.Left(FHippocacheResult::InlineKeyLength), FHippocacheKey::HashString(LongKey));
+            TestEqual("A long key should be truncated and identified by its hash", Subsystem->GetStructTyped<FTestStruct>(TEXT("ReadTest"), LongKey).Result.GetErrorContext(), LongContext);
+            TestEqual("A missing collection should name only the collection", Subsystem->GetStructTyped<FTestStruct>(TEXT("Nowhere"), TEXT("Key")).Result.GetErrorContext(), FString(TEXT("Collection: Nowhere")));
+
+            const FHippocacheResult Eager = FHippocacheResult::Error(EHippocacheErrorCode::InvalidKey, TEXT("Message"), TEXT("Context"));
+            TestEqual("An eager message should be returned as is", Eager.GetErrorMessage(), FString(TEXT("Message")));
+            TestEqual("An eager context should be returned as is", Eager.GetErrorContext(), FString(TEXT("Context")));
+        });
+
+        It("should keep the viewed value alive across a concurrent Remove", [this]()
+        {
+            UHippocacheSubsystem* Subsystem = NewObject<UHippocacheSubsystem>();
+            FHippocacheCollectionHandle Handle;
+            Subsystem->CreateOrGetCollection(TEXT("ReadTest"), Handle);
+
+            FTestStruct Value;
+            Value.IntValue = 42;
+            Value.StringValue = TEXT("Pinned");
+            Subsystem->SetStruct(Handle, TEXT("Key"), FInstancedStruct::Make(Value));
+
+            Subsystem->ReadStruct(Handle, TEXT("Key"), [&](FConstStructView View)
+            {
+                // Removing from another thread while the view is held must not free it under us
+                Async(EAsyncExecution::Thread, [Subsystem, Handle]()
+                {
+                    Subsystem->Remove(Handle, TEXT("Key"));
+                    FHippocacheEpoch::Reclaim();
+                }).Wait();
+
+                TestEqual("Viewed value should be intact", View.Get<FTestStruct>().StringValue, FString(TEXT("Pinned")));
+            });
+
+            FInstancedStruct OutValue;
+            TestEqual("Item should be gone afterwards", Subsystem->GetStruct(Handle, TEXT("Key"), OutValue).ErrorCode, EHippocacheErrorCode::ItemNotFound);
+        });
+    });
+
+    Describe("Raw-memory Access", [this]()
+    {
+        It("should copy between caller memory and the cache for a run-time type", [this]()
+        {
+            UHippocacheSubsystem* Subsystem = NewObject<UHippocacheSubsystem>();
+            const UScriptStruct* Struct = FTestStruct::StaticStruct();
+            FTestStruct Value;
+            Value.IntValue = 7;
+            Value.StringValue = TEXT("Raw");
+
+            TestTrue("Raw SetStruct should succeed", Subsystem->SetStruct(TEXT("RawTest"), FHippocacheKey(TEXT("Key")), Struct, &Value).IsSuccess());
+            Value.StringValue = TEXT("Changed");
+
+            FTestStruct OutValue;
+            TestTrue("Raw GetStruct should succeed", Subsystem->GetStruct(TEXT("RawTest"), TEXT("Key"), Struct, &OutValue).IsSuccess());
+            TestEqual("The cached copy should not follow the source", OutValue.StringValue, FString(TEXT("Raw")));
+            TestEqual("The value should round-trip", OutValue.IntValue, 7);
+
+            FHugeStruct WrongType;
+            TestEqual("Wrong type should fail", Subsystem->GetStruct(TEXT("RawTest"), TEXT("Key"), FHugeStruct::StaticStruct(), &WrongType).ErrorCode, EHippocacheErrorCode::TypeMismatch);
+            TestEqual("Missing destination should fail", Subsystem->GetStruct(TEXT("RawTest"), TEXT("Key"), Struct, nullptr).ErrorCode, EHippocacheErrorCode::InvalidValue);
+            TestEqual("Missing source should fail", Subsystem->SetStruct(TEXT("RawTest"), TEXT("Other"), Struct, nullptr).ErrorCode, EHippocacheErrorCode::InvalidValue);
+        });
+
+        It("should cache container values described by their property", [this]()
+        {
+            UHippocacheSubsystem* Subsystem = NewObject<UHippocacheSubsystem>();
+            const FProperty* ArrayProperty = FHugeStruct::StaticStruct()->FindPropertyByName(GET_MEMBER_NAME_CHECKED(FHugeStruct, MassiveArray));
+            const FProperty* MapProperty = FHugeStruct::StaticStruct()->FindPropertyByName(GET_MEMBER_NAME_CHECKED(FHugeStruct, HugeMap));
+            FHugeStruct Source;
+            const int32 ArrayNum = Source.MassiveArray.Num();
+
+            TestTrue("Set should succeed", Subsystem->SetStruct(TEXT("RawTest"), TEXT("Array"), FHippocachePropertyValue(ArrayProperty, &Source.MassiveArray)).IsSuccess());
+            Source.MassiveArray.Reset();
+
+            TArray<int32> OutArray;
+            TestTrue("Read should succeed", Subsystem->ReadStructTyped<FHippocachePropertyValue>(TEXT("RawTest"), TEXT("Array"), [&](const FHippocachePropertyValue& Value)
+            {
+                TestTrue("The value should match its own property", Value.IsSameType(ArrayProperty));
+                TestFalse("An array should not match a map", Value.IsSameType(MapProperty));
+                Value.CopyTo(ArrayProperty, &OutArray);
+            }).IsSuccess());
+            TestEqual("The cached array should not follow the source", OutArray.Num(), ArrayNum);
+        });
+
+        It("should keep container values readable after their source property is freed", [this]()
+        {
+            UHippocacheSubsystem* Subsystem = NewObject<UHippocacheSubsystem>();
+            const FProperty* ArrayProperty = FHugeStruct::StaticStruct()->FindPropertyByName(GET_MEMBER_NAME_CHECKED(FHugeStruct, MassiveArray));
+            FHugeStruct Source;
+
+            // Stands in for a Blueprint variable whose class is recompiled after the write
+            FProperty* TransientProperty = CastFieldChecked<FProperty>(FField::Duplicate(ArrayProperty, FFieldVariant(), TEXT("Transient")));
+            TestTrue("Set should succeed", Subsystem->SetStruct(TEXT("RawTest"), TEXT("Orphan"), FHippocachePropertyValue(TransientProperty, &Source.MassiveArray)).IsSuccess());
+            delete TransientProperty;
+
+            TArray<int32> OutArray;
+            TestTrue("Read should succeed", Subsystem->ReadStructTyped<FHippocachePropertyValue>(TEXT("RawTest"), TEXT("Orphan"), [&](const FHippocachePropertyValue& Value)
+            {
+                TestTrue("The value should own its property", Value.GetProperty() != nullptr && Value.GetProperty() != TransientProperty);
+                TestTrue("The value should still match an equivalent property", Value.IsSameType(ArrayProperty));
+                Value.CopyTo(ArrayProperty, &OutArray);
+            }).IsSuccess());
+            TestEqual("The cached array should survive", OutArray, Source.MassiveArray);
+        });
+    });
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,167 @@
+#include "CoreTypes.h"
+#include "Misc/AutomationTest.h"
+#include "Async/Async.h"
+#include "HippocacheCollection.h"
+#include "HippocacheEpoch.h"
+#include "HippocacheSlabAllocator.h"
+#include "HippocacheSubsystem.h"
+#include "Runtime/Launch/Resources/Version.h"
+#include "Tests/TestStructs.h"
+#include <atomic>
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+// ApplicationContextMask is deprecated in UE 5.6+, use conditional compilation for compatibility
+#if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 6
+DEFINE_SPEC(FHippocacheSlabAllocatorSpec, "Hippocache.SlabAllocator",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+#else
+DEFINE_SPEC(FHippocacheSlabAllocatorSpec, "Hippocache.SlabAllocator",
+    EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+#endif
+
+void FHippocacheSlabAllocatorSpec::Define()
+{
+    Describe("Slab Allocator", [this]()
+    {
+        It("should pack same-sized blocks into one page and reuse freed blocks", [this]()
+        {
+            FHippocacheSlabAllocator Allocator;
+            void* First = Allocator.Allocate(100);
+            void* Second = Allocator.Allocate(100);
+            TestEqual("Blocks should be contiguous", static_cast<uint8*>(Second) - static_cast<uint8*>(First), static_cast<PTRINT>(112));
+            TestEqual("Blocks should be aligned", reinterpret_cast<UPTRINT>(First) % FHippocacheSlabAllocator::BlockAlignment, static_cast<UPTRINT>(0));
+            TestEqual("One page should hold both", Allocator.NumPages(), 1);
+
+            FHippocacheSlabAllocator::Free(First);
+            TestEqual("Freed block should be reused", Allocator.Allocate(100), First);
+            TestEqual("Two blocks should be live", Allocator.NumAllocatedBlocks(), 2);
+
+            Allocator.Allocate(500);
+            TestEqual("Another size class should take its own page", Allocator.NumPages(), 2);
+        });
+    });
+
+    Describe("Slab-backed Collections", [this]()
+    {
+        for (const EHippocacheIndexType IndexType : { EHippocacheIndexType::FlatTable, EHippocacheIndexType::TMap })
+        {
+            It(FString::Printf(TEXT("should store, overwrite and remove items with a %s index"), *UEnum::GetValueAsString(IndexType)), [this, IndexType]()
+            {
+                FHippocacheCollection Collection(TEXT("SlabTest"), 4, IndexType, EHippocacheValueAllocator::Slab);
+
+                FTestStruct Value;
+                Value.IntValue = 1;
+                Value.StringValue = TEXT("One");
+                TestTrue("Set should succeed", Collection.Set(TEXT("Key"), FInstancedStruct::Make(Value), FTimespan::Zero()).IsSuccess());
+
+                const FVector Location(1.0, 2.0, 3.0);
+                TestTrue("Inline set should succeed", Collection.Set(TEXT("Location"), FInstancedStruct::Make(Location), FTimespan::Zero()).IsSuccess());
+
+                Value.IntValue = 2;
+                Value.StringValue = TEXT("Two");
+                TestTrue("Overwrite should succeed", Collection.Set(TEXT("Key"), FInstancedStruct::Make(Value), FTimespan::Zero()).IsSuccess());
+
+                FInstancedStruct OutValue;
+                TestTrue("Get should succeed", Collection.Get(TEXT("Key"), OutValue).IsSuccess());
+                TestEqual("Overwrite should have replaced the value", OutValue.Get<FTestStruct>().StringValue, FString(TEXT("Two")));
+                TestTrue("Inline get should succeed", Collection.Get(TEXT("Location"), OutValue).IsSuccess());
+                TestEqual("Inline value should round-trip", OutValue.Get<FVector>(), Location);
+
+                TestTrue("Remove should succeed", Collection.Remove(TEXT("Key")).IsSuccess());
+                TestEqual("Removed item should be gone", Collection.Get(TEXT("Key"), OutValue).ErrorCode, EHippocacheErrorCode::ItemNotFound);
+                TestEqual("One item should remain", Collection.Num(), 1);
+            });
+
+            It(FString::Printf(TEXT("should clear every item with a %s index"), *UEnum::GetValueAsString(IndexType)), [this, IndexType]()
+            {
+                FHippocacheCollection Collection(TEXT("SlabTest"), 4, IndexType, EHippocacheValueAllocator::Slab);
+                for (int32 Index = 0; Index < 1000; ++Index)
+                {
+                    FTestStruct Value;
+                    Value.IntValue = Index;
+                    Value.StringValue = FString::FromInt(Index);
+                    Collection.Set(FString::Printf(TEXT("Key_%d"), Index), FInstancedStruct::Make(Value), FTimespan::Zero());
+                }
+
+                TestEqual("Clear should report every item", Collection.Clear(), 1000);
+                TestEqual("Collection should be empty", Collection.Num(), 0);
+                FHippocacheEpoch::Reclaim();
+
+                FTestStruct Value;
+                Value.IntValue = 7;
+                TestTrue("Set after Clear should succeed", Collection.Set(TEXT("Key_7"), FInstancedStruct::Make(Value), FTimespan::Zero()).IsSuccess());
+                FInstancedStruct OutValue;
+                TestTrue("Get after Clear should succeed", Collection.Get(TEXT("Key_7"), OutValue).IsSuccess());
+                TestEqual("Value should match", OutValue.Get<FTestStruct>().IntValue, 7);
+            });
+        }
+
+        It("should release slabs only after their entries while several threads reclaim", [this]()
+        {
+            std::atomic<bool> bWriting { true };
+            TArray<TFuture<void>> Reclaimers;
+            for (int32 Thread = 0; Thread < 2; ++Thread)
+            {
+                Reclaimers.Add(Async(EAsyncExecution::Thread, [&bWriting]()
+                {
+                    while (bWriting.load())
+                    {
+                        FHippocacheEpoch::Reclaim();
+                    }
+                }));
+            }
+
+            for (const EHippocacheIndexType IndexType : { EHippocacheIndexType::FlatTable, EHippocacheIndexType::TMap })
+            {
+                FHippocacheCollection Collection(TEXT("SlabTest"), 2, IndexType, EHippocacheValueAllocator::Slab);
+                for (int32 Round = 0; Round < 50; ++Round)
+                {
+                    // Overwrites and removes retire slab entries; Clear then retires the slab they came from
+                    for (int32 Index = 0; Index < 200; ++Index)
+                    {
+                        FTestStruct Value;
+                        Value.IntValue = Index;
+                        Value.StringValue = FString::FromInt(Round);
+                        const FString Key = FString::Printf(TEXT("Key_%d"), Index % 50);
+                        Collection.Set(Key, FInstancedStruct::Make(Value), FTimespan::Zero());
+                        if (Index % 7 == 0)
+                        {
+                            Collection.Remove(Key);
+                        }
+                    }
+                    Collection.Clear();
+                }
+                TestEqual("The collection should end up empty", Collection.Num(), 0);
+            }
+
+            bWriting = false;
+            for (TFuture<void>& Reclaimer : Reclaimers)
+            {
+                Reclaimer.Wait();
+            }
+            FHippocacheEpoch::Reclaim();
+            TestEqual("Everything retired should be reclaimed", FHippocacheEpoch::NumPendingRetired(), 0);
+        });
+
+        It("should be selectable through collection options", [this]()
+        {
+            UHippocacheSubsystem* Subsystem = NewObject<UHippocacheSubsystem>();
+            FHippocacheCollectionOptions Options;
+            Options.ValueAllocator = EHippocacheValueAllocator::Slab;
+            TestTrue("CreateCollection should succeed", Subsystem->CreateCollection(TEXT("SlabTest"), Options).IsSuccess());
+
+            FHippocacheCollectionHandle Handle;
+            Subsystem->CreateOrGetCollection(TEXT("SlabTest"), Handle);
+            FTestStruct Value;
+            Value.IntValue = 3;
+            TestTrue("Set should succeed", Subsystem->SetStruct(Handle, TEXT("Key"), FInstancedStruct::Make(Value)).IsSuccess());
+
+            FInstancedStruct OutValue;
+            TestTrue("Get should succeed", Subsystem->GetStruct(TEXT("SlabTest"), TEXT("Key"), OutValue).IsSuccess());
+            TestEqual("Value should match", OutValue.Get<FTestStruct>().IntValue, 3);
+        });
+    });
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,134 @@
+#include "CoreTypes.h"
+#include "Misc/AutomationTest.h"
+#include "HippocacheSubsystem.h"
+#include "Runtime/Launch/Resources/Version.h"
+#include "Tests/TestStructs.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+// ApplicationContextMask is deprecated in UE 5.6+, use conditional compilation for compatibility
+#if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 6
+DEFINE_SPEC(FHippocacheTypedCollectionSpec, "Hippocache.TypedCollection",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+#else
+DEFINE_SPEC(FHippocacheTypedCollectionSpec, "Hippocache.TypedCollection",
+    EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+#endif
+
+void FHippocacheTypedCollectionSpec::Define()
+{
+    Describe("Typed Collections", [this]()
+    {
+        It("should store values of the pinned type and reject others", [this]()
+        {
+            UHippocacheSubsystem* Subsystem = NewObject<UHippocacheSubsystem>();
+            TestTrue("CreateTypedCollection should succeed", Subsystem->CreateTypedCollection<FTestStruct>(TEXT("Typed")).IsSuccess());
+
+            FTestStruct Value;
+            Value.IntValue = 5;
+            Value.StringValue = TEXT("Five");
+            TestTrue("Set should succeed", Subsystem->SetStruct(TEXT("Typed"), TEXT("Key"), Value).IsSuccess());
+
+            THippocacheResult<FTestStruct> Result = Subsystem->GetStructTyped<FTestStruct>(TEXT("Typed"), TEXT("Key"));
+            TestTrue("Get should succeed", Result.IsSuccess());
+            TestEqual("Value should round-trip", Result.Value.StringValue, FString(TEXT("Five")));
+
+            Value.IntValue = 6;
+            TestTrue("Overwrite should succeed", Subsystem->SetStruct(TEXT("Typed"), TEXT("key"), Value).IsSuccess());
+            TestEqual("Overwrite should replace the value", Subsystem->GetStructTyped<FTestStruct>(TEXT("Typed"), TEXT("KEY")).Value.IntValue, 6);
+
+            TestEqual("Other types should be rejected", Subsystem->SetStruct(TEXT("Typed"), TEXT("Other"), FInstancedStruct::Make(FVector::OneVector)).ErrorCode, EHippocacheErrorCode::TypeMismatch);
+        });
+
+        It("should keep the remaining items reachable after removals", [this]()
+        {
+            UHippocacheSubsystem* Subsystem = NewObject<UHippocacheSubsystem>();
+            FHippocacheCollectionOptions Options;
+            Options.ShardCount = 1;
+            Subsystem->CreateTypedCollection<FTestStruct>(TEXT("Typed"), Options);
+
+            for (int32 Index = 0; Index < 100; ++Index)
+            {
+                FTestStruct Value;
+                Value.IntValue = Index;
+                Subsystem->SetStruct(TEXT("Typed"), FString::Printf(TEXT("Key_%d"), Index), Value);
+            }
+
+            // Removing from the front moves items from the back into the holes
+            for (int32 Index = 0; Index < 100; Index += 3)
+            {
+                TestTrue("Remove should succeed", Subsystem->Remove(TEXT("Typed"), FString::Printf(TEXT("Key_%d"), Index)).IsSuccess());
+            }
+
+            for (int32 Index = 0; Index < 100; ++Index)
+            {
+                THippocacheResult<FTestStruct> Result = Subsystem->GetStructTyped<FTestStruct>(TEXT("Typed"), FString::Printf(TEXT("Key_%d"), Index));
+                if (Index % 3 == 0)
+                {
+                    TestEqual("Removed item should be gone", Result.ErrorCode, EHippocacheErrorCode::ItemNotFound);
+                }
+                else
+                {
+                    TestEqual("Remaining item should keep its value", Result.Value.IntValue, Index);
+                }
+            }
+        });
+
+        It("should visit every item", [this]()
+        {
+            UHippocacheSubsystem* Subsystem = NewObject<UHippocacheSubsystem>();
+            Subsystem->CreateTypedCollection<FTestStruct>(TEXT("Typed"));
+
+            int32 ExpectedSum = 0;
+            for (int32 Index = 0; Index < 50; ++Index)
+            {
+                FTestStruct Value;
+                Value.IntValue = Index;
+                Subsystem->SetStruct(TEXT("Typed"), FString::Printf(TEXT("Key_%d"), Index), Value);
+                ExpectedSum += Index;
+            }
+
+            int32 VisitCount = 0;
+            int32 Sum = 0;
+            TestTrue("ForEachStructTyped should succeed", Subsystem->ForEachStructTyped<FTestStruct>(TEXT("Typed"), [&VisitCount, &Sum](const FString& Key, const FTestStruct& Value)
+            {
+                ++VisitCount;
+                Sum += Value.IntValue;
+            }).IsSuccess());
+            TestEqual("Every item should be visited once", VisitCount, 50);
+            TestEqual("Every value should be visited", Sum, ExpectedSum);
+
+            FHippocacheCollectionHandle Handle;
+            Subsystem->CreateOrGetCollection(TEXT("Typed"), Handle);
+            TestTrue("Clear should succeed", Subsystem->Clear(Handle).IsSuccess());
+            int32 Count = -1;
+            Subsystem->Num(Handle, Count);
+            TestEqual("Clear should empty the collection", Count, 0);
+        });
+
+        It("should also visit mixed collections, skipping other types", [this]()
+        {
+            UHippocacheSubsystem* Subsystem = NewObject<UHippocacheSubsystem>();
+            FTestStruct Value;
+            Value.IntValue = 1;
+            Subsystem->SetStruct(TEXT("Mixed"), TEXT("Struct"), Value);
+            Subsystem->SetStruct(TEXT("Mixed"), TEXT("Vector"), FInstancedStruct::Make(FVector::OneVector));
+
+            int32 VisitCount = 0;
+            Subsystem->ForEachStruct(TEXT("Mixed"), [&VisitCount](const FString& Key, FConstStructView View)
+            {
+                ++VisitCount;
+            });
+            TestEqual("Both items should be visited", VisitCount, 2);
+
+            int32 TypedVisitCount = 0;
+            Subsystem->ForEachStructTyped<FTestStruct>(TEXT("Mixed"), [&TypedVisitCount](const FString& Key, const FTestStruct& Value)
+            {
+                ++TypedVisitCount;
+            });
+            TestEqual("Only the matching type should be visited", TypedVisitCount, 1);
+        });
+    });
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,107 @@
+#include "CoreTypes.h"
+#include "Misc/AutomationTest.h"
+#include "Async/ParallelFor.h"
+#include "HippocacheSubsystem.h"
+#include "Runtime/Launch/Resources/Version.h"
+#include "Tests/TestStructs.h"
+#include "Tests/WeirdTestStructs.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+// ApplicationContextMask is deprecated in UE 5.6+, use conditional compilation for compatibility
+#if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 6
+DEFINE_SPEC(FHippocacheUpdateStructSpec, "Hippocache.UpdateStruct",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+#else
+DEFINE_SPEC(FHippocacheUpdateStructSpec, "Hippocache.UpdateStruct",
+    EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+#endif
+
+void FHippocacheUpdateStructSpec::Define()
+{
+    Describe("In-place Updates", [this]()
+    {
+        It("should update values in every collection layout", [this]()
+        {
+            UHippocacheSubsystem* Subsystem = NewObject<UHippocacheSubsystem>();
+            FHippocacheCollectionOptions MapOptions;
+            MapOptions.IndexType = EHippocacheIndexType::TMap;
+            Subsystem->CreateCollection(TEXT("Map"), MapOptions);
+            FHippocacheCollectionOptions SlabOptions;
+            SlabOptions.ValueAllocator = EHippocacheValueAllocator::Slab;
+            Subsystem->CreateCollection(TEXT("Slab"), SlabOptions);
+            Subsystem->CreateTypedCollection<FTestStruct>(TEXT("Typed"));
+
+            for (const FName Collection : { FName(TEXT("Flat")), FName(TEXT("Map")), FName(TEXT("Slab")), FName(TEXT("Typed")) })
+            {
+                FTestStruct Value;
+                Value.IntValue = 1;
+                Value.StringValue = TEXT("Stats");
+                Subsystem->SetStruct(Collection, TEXT("Player"), Value);
+
+                TestTrue("UpdateStructTyped should succeed", Subsystem->UpdateStructTyped<FTestStruct>(Collection, TEXT("Player"), [](FTestStruct& Stats)
+                {
+                    Stats.IntValue += 10;
+                    Stats.StringValue += TEXT("!");
+                }).IsSuccess());
+
+                THippocacheResult<FTestStruct> Result = Subsystem->GetStructTyped<FTestStruct>(Collection, TEXT("Player"));
+                TestEqual(FString::Printf(TEXT("%s should see the updated counter"), *Collection.ToString()), Result.Value.IntValue, 11);
+                TestEqual(FString::Printf(TEXT("%s should see the updated string"), *Collection.ToString()), Result.Value.StringValue, FString(TEXT("Stats!")));
+            }
+
+            // Small plain-old-data values are updated inline
+            Subsystem->SetStruct(TEXT("Flat"), TEXT("Location"), FInstancedStruct::Make(FVector(1.0, 2.0, 3.0)));
+            TestTrue("UpdateStruct should succeed", Subsystem->UpdateStruct(TEXT("Flat"), FHippocacheKey(TEXT("Location")), [](FStructView View)
+            {
+                View.Get<FVector>().Z = 30.0;
+            }).IsSuccess());
+            FInstancedStruct OutValue;
+            Subsystem->GetStruct(TEXT("Flat"), TEXT("Location"), OutValue);
+            TestEqual("Inline value should be updated", OutValue.Get<FVector>(), FVector(1.0, 2.0, 30.0));
+        });
+
+        It("should report errors without calling the mutator", [this]()
+        {
+            UHippocacheSubsystem* Subsystem = NewObject<UHippocacheSubsystem>();
+            FTestStruct Value;
+            Subsystem->SetStruct(TEXT("UpdateTest"), TEXT("Key"), Value);
+            Subsystem->SetStructWithTTL(TEXT("UpdateTest"), TEXT("Expired"), Value, FTimespan::FromMilliseconds(1.0));
+            FPlatformProcess::Sleep(0.01f);
+
+            bool bMutated = false;
+            TestEqual("Missing collection should fail", Subsystem->UpdateStruct(TEXT("Missing"), TEXT("Key"), [&bMutated](FStructView View) { bMutated = true; }).ErrorCode, EHippocacheErrorCode::ItemNotFound);
+            TestEqual("Missing key should fail", Subsystem->UpdateStruct(TEXT("UpdateTest"), TEXT("Missing"), [&bMutated](FStructView View) { bMutated = true; }).ErrorCode, EHippocacheErrorCode::ItemNotFound);
+            TestEqual("Expired item should fail", Subsystem->UpdateStruct(TEXT("UpdateTest"), TEXT("Expired"), [&bMutated](FStructView View) { bMutated = true; }).ErrorCode, EHippocacheErrorCode::ItemExpired);
+            TestEqual("Wrong type should fail", Subsystem->UpdateStructTyped<FSimpleTestStruct>(TEXT("UpdateTest"), TEXT("Key"), [&bMutated](FSimpleTestStruct& View) { bMutated = true; }).ErrorCode, EHippocacheErrorCode::TypeMismatch);
+            TestFalse("Mutator should not run on failure", bMutated);
+        });
+
+        It("should not lose concurrent updates of the same key", [this]()
+        {
+            UHippocacheSubsystem* Subsystem = NewObject<UHippocacheSubsystem>();
+            FHippocacheCollectionHandle Handle;
+            Subsystem->CreateOrGetCollection(TEXT("UpdateTest"), Handle);
+
+            FTestStruct Value;
+            Subsystem->SetStruct(Handle, TEXT("Counter"), FInstancedStruct::Make(Value));
+
+            const int32 NumThreads = 8;
+            const int32 UpdatesPerThread = 1000;
+            ParallelFor(NumThreads, [Subsystem, Handle, UpdatesPerThread](int32 ThreadIndex)
+            {
+                for (int32 Index = 0; Index < UpdatesPerThread; ++Index)
+                {
+                    Subsystem->UpdateStruct(Handle, TEXT("Counter"), [](FStructView View)
+                    {
+                        ++View.Get<FTestStruct>().IntValue;
+                    });
+                }
+            });
+
+            TestEqual("Every increment should be applied", Subsystem->GetStructTyped<FTestStruct>(TEXT("UpdateTest"), TEXT("Counter")).Value.IntValue, NumThreads * UpdatesPerThread);
+        });
+    });
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -3,6 +3,7 @@
 #include "Hippocache.h"
 #include "HippocacheClient.h"
 #include "HippocacheSubsystem.h"
+#include "HippocacheEpoch.h"
 
 #define LOCTEXT_NAMESPACE "FhippocacheModule"
 
@@ -16,6 +17,9 @@ void FhippocacheModule::ShutdownModule()
 {
 	// This function may be called during shutdown to clean up your module.  For modules that support dynamic reloading,
 	// we call this function before unloading the module.
+
+	// No cache reader can outlive the module, so everything still waiting on readers can go now
+	FHippocacheEpoch::Shutdown();
 }
 
 #undef LOCTEXT_NAMESPACE
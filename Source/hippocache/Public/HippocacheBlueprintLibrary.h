@@ -5,6 +5,7 @@
 #include "Kismet/KismetSystemLibrary.h"
 #include "HippocacheSubsystem.h"
 #include "HippocacheResult.h"
+#include "HippocacheKey.h"
 #include "HippocacheVariantWrapper.h"
 #include "HippocacheBlueprintLibrary.generated.h"
 
@@ -65,6 +66,33 @@ public:
 		return Subsystem->SetStruct<T>(Collection, Key, Value);
 	}
 
+	// Rvalue overloads - the value is moved into the cache instead of copied
+	template<typename T, typename = THippocacheMovableValue<T>>
+	static FHippocacheResult SetStructWithTTL(const UObject* WorldContextObject, FName Collection, const FString& Key, T&& Value, float TTLSeconds)
+	{
+		UHippocacheSubsystem* Subsystem = nullptr;
+		FHippocacheResult Result = GetSubsystemSafe(WorldContextObject, Subsystem);
+		if (Result.IsError())
+		{
+			return Result;
+		}
+
+		return Subsystem->SetStructWithTTL<T>(Collection, Key, MoveTemp(Value), FTimespan::FromSeconds(TTLSeconds));
+	}
+
+	template<typename T, typename = THippocacheMovableValue<T>>
+	static FHippocacheResult SetStruct(const UObject* WorldContextObject, FName Collection, const FString& Key, T&& Value)
+	{
+		UHippocacheSubsystem* Subsystem = nullptr;
+		FHippocacheResult Result = GetSubsystemSafe(WorldContextObject, Subsystem);
+		if (Result.IsError())
+		{
+			return Result;
+		}
+
+		return Subsystem->SetStruct<T>(Collection, Key, MoveTemp(Value));
+	}
+
 	template<typename T>
 	static THippocacheResult<T> GetStruct(const UObject* WorldContextObject, FName Collection, const FString& Key)
 	{
@@ -72,7 +100,7 @@ public:
 		FHippocacheResult Result = GetSubsystemSafe(WorldContextObject, Subsystem);
 		if (Result.IsError())
 		{
-			return THippocacheResult<T>::Error(Result.ErrorCode, Result.ErrorMessage, Result.ErrorContext);
+			return THippocacheResult<T>(Result);
 		}
 
 		return Subsystem->GetStructTyped<T>(Collection, Key);
@@ -86,22 +114,41 @@ public:
 		FHippocacheResult Result = GetSubsystemSafe(WorldContextObject, Subsystem);
 		if (Result.IsError())
 		{
-			return THippocacheResult<FInstancedStruct>::Error(Result.ErrorCode, Result.ErrorMessage, Result.ErrorContext);
+			return THippocacheResult<FInstancedStruct>(Result);
 		}
 
 		FInstancedStruct OutValue;
 		Result = Subsystem->GetStruct(Collection, Key, OutValue);
 		if (Result.IsError())
 		{
-			return THippocacheResult<FInstancedStruct>::Error(Result.ErrorCode, Result.ErrorMessage, Result.ErrorContext);
+			return THippocacheResult<FInstancedStruct>(Result);
 		}
 
 		return THippocacheResult<FInstancedStruct>::Success(OutValue);
 	}
 
-	// C++ only template functions for primitive type access via FVariant
+	// C++ only template functions for primitive type access
 	template<typename T>
 	static FHippocacheResult SetPrimitiveWithTTL(const UObject* WorldContextObject, FName Collection, const FString& Key, const T& Value, float TTLSeconds)
+	{
+		return SetPrimitiveImpl<T>(WorldContextObject, Collection, Key, Value, FTimespan::FromSeconds(TTLSeconds));
+	}
+
+	template<typename T>
+	static FHippocacheResult SetPrimitive(const UObject* WorldContextObject, FName Collection, const FString& Key, const T& Value)
+	{
+		return SetPrimitiveImpl<T>(WorldContextObject, Collection, Key, Value, FTimespan::Zero());
+	}
+
+	template<typename T>
+	static FHippocacheResult GetPrimitive(const UObject* WorldContextObject, FName Collection, const FString& Key, T& OutValue)
+	{
+		return GetPrimitiveImpl<T>(WorldContextObject, Collection, Key, OutValue);
+	}
+
+	// FHippocacheKey overloads of the C++ templates above - reuse the key's precomputed hash
+	template<typename T>
+	static FHippocacheResult SetStructWithTTL(const UObject* WorldContextObject, FName Collection, const FHippocacheKey& Key, const T& Value, float TTLSeconds)
 	{
 		UHippocacheSubsystem* Subsystem = nullptr;
 		FHippocacheResult Result = GetSubsystemSafe(WorldContextObject, Subsystem);
@@ -110,16 +157,11 @@ public:
 			return Result;
 		}
 
-		// Wrap primitive value in FVariantWrapper and store as FInstancedStruct
-		FVariantWrapper Wrapper((FVariant(Value)));
-		FInstancedStruct InstancedStruct = FInstancedStruct::Make<FVariantWrapper>(Wrapper);
-		
-		FTimespan TTL = FTimespan::FromSeconds(TTLSeconds);
-		return Subsystem->SetStructWithTTL(Collection, Key, InstancedStruct, TTL);
+		return Subsystem->SetStructWithTTL<T>(Collection, Key, Value, FTimespan::FromSeconds(TTLSeconds));
 	}
 
 	template<typename T>
-	static FHippocacheResult SetPrimitive(const UObject* WorldContextObject, FName Collection, const FString& Key, const T& Value)
+	static FHippocacheResult SetStruct(const UObject* WorldContextObject, FName Collection, const FHippocacheKey& Key, const T& Value)
 	{
 		UHippocacheSubsystem* Subsystem = nullptr;
 		FHippocacheResult Result = GetSubsystemSafe(WorldContextObject, Subsystem);
@@ -128,15 +170,11 @@ public:
 			return Result;
 		}
 
-		// Wrap primitive value in FVariantWrapper and store as FInstancedStruct
-		FVariantWrapper Wrapper((FVariant(Value)));
-		FInstancedStruct InstancedStruct = FInstancedStruct::Make<FVariantWrapper>(Wrapper);
-		
-		return Subsystem->SetStruct(Collection, Key, InstancedStruct);
+		return Subsystem->SetStruct<T>(Collection, Key, Value);
 	}
 
-	template<typename T>
-	static FHippocacheResult GetPrimitive(const UObject* WorldContextObject, FName Collection, const FString& Key, T& OutValue)
+	template<typename T, typename = THippocacheMovableValue<T>>
+	static FHippocacheResult SetStructWithTTL(const UObject* WorldContextObject, FName Collection, const FHippocacheKey& Key, T&& Value, float TTLSeconds)
 	{
 		UHippocacheSubsystem* Subsystem = nullptr;
 		FHippocacheResult Result = GetSubsystemSafe(WorldContextObject, Subsystem);
@@ -145,42 +183,136 @@ public:
 			return Result;
 		}
 
-		FInstancedStruct OutStruct;
-		Result = Subsystem->GetStruct(Collection, Key, OutStruct);
+		return Subsystem->SetStructWithTTL<T>(Collection, Key, MoveTemp(Value), FTimespan::FromSeconds(TTLSeconds));
+	}
+
+	template<typename T, typename = THippocacheMovableValue<T>>
+	static FHippocacheResult SetStruct(const UObject* WorldContextObject, FName Collection, const FHippocacheKey& Key, T&& Value)
+	{
+		UHippocacheSubsystem* Subsystem = nullptr;
+		FHippocacheResult Result = GetSubsystemSafe(WorldContextObject, Subsystem);
 		if (Result.IsError())
 		{
 			return Result;
 		}
 
-		// Check if it's a FVariantWrapper
-		if (!OutStruct.IsValid() || OutStruct.GetScriptStruct() != FVariantWrapper::StaticStruct())
+		return Subsystem->SetStruct<T>(Collection, Key, MoveTemp(Value));
+	}
+
+	template<typename T>
+	static THippocacheResult<T> GetStruct(const UObject* WorldContextObject, FName Collection, const FHippocacheKey& Key)
+	{
+		UHippocacheSubsystem* Subsystem = nullptr;
+		FHippocacheResult Result = GetSubsystemSafe(WorldContextObject, Subsystem);
+		if (Result.IsError())
 		{
-			return FHippocacheResult::Error(EHippocacheErrorCode::TypeMismatch, 
-				TEXT("Expected FVariantWrapper"), 
-				FString::Printf(TEXT("Collection: %s, Key: %s"), *Collection.ToString(), *Key));
+			return THippocacheResult<T>(Result);
 		}
 
-		const FVariantWrapper* Wrapper = OutStruct.GetPtr<FVariantWrapper>();
-		if (!Wrapper)
+		if constexpr (std::is_same_v<T, FInstancedStruct>)
 		{
-			return FHippocacheResult::Error(EHippocacheErrorCode::TypeMismatch, 
-				TEXT("Failed to extract FVariantWrapper"), 
-				FString::Printf(TEXT("Collection: %s, Key: %s"), *Collection.ToString(), *Key));
+			FInstancedStruct OutValue;
+			Result = Subsystem->GetStruct(Collection, Key, OutValue);
+			if (Result.IsError())
+			{
+				return THippocacheResult<FInstancedStruct>(Result);
+			}
+			return THippocacheResult<FInstancedStruct>::Success(OutValue);
+		}
+		else
+		{
+			return Subsystem->GetStructTyped<T>(Collection, Key);
+		}
+	}
+
+	template<typename T>
+	static FHippocacheResult SetPrimitiveWithTTL(const UObject* WorldContextObject, FName Collection, const FHippocacheKey& Key, const T& Value, float TTLSeconds)
+	{
+		return SetPrimitiveImpl<T>(WorldContextObject, Collection, Key, Value, FTimespan::FromSeconds(TTLSeconds));
+	}
+
+	template<typename T>
+	static FHippocacheResult SetPrimitive(const UObject* WorldContextObject, FName Collection, const FHippocacheKey& Key, const T& Value)
+	{
+		return SetPrimitiveImpl<T>(WorldContextObject, Collection, Key, Value, FTimespan::Zero());
+	}
+
+	template<typename T>
+	static FHippocacheResult GetPrimitive(const UObject* WorldContextObject, FName Collection, const FHippocacheKey& Key, T& OutValue)
+	{
+		return GetPrimitiveImpl<T>(WorldContextObject, Collection, Key, OutValue);
+	}
+
+private:
+	// Shared bodies of the string and FHippocacheKey primitive overloads
+	template<typename T, typename KeyType>
+	static FHippocacheResult SetPrimitiveImpl(const UObject* WorldContextObject, FName Collection, const KeyType& Key, const T& Value, FTimespan TTL)
+	{
+		UHippocacheSubsystem* Subsystem = nullptr;
+		FHippocacheResult Result = GetSubsystemSafe(WorldContextObject, Subsystem);
+		if (Result.IsError())
+		{
+			return Result;
 		}
 
-		// Check if the FVariant holds the expected type
-		if (!Wrapper->IsType<T>())
+		// Values are cached natively - primitives in their wrapper struct, engine structs as themselves - so
+		// they are copied straight into the cache slot and the atomic operations can change numbers in place
+		if constexpr (THippocachePrimitiveWrapper<T>::bSupported)
+		{
+			return Subsystem->SetStructWithTTL(Collection, Key, typename THippocachePrimitiveWrapper<T>::Type(Value), TTL);
+		}
+		else
+		{
+			return Subsystem->SetStructWithTTL<T>(Collection, Key, Value, TTL);
+		}
+	}
+
+	template<typename T, typename KeyType>
+	static FHippocacheResult GetPrimitiveImpl(const UObject* WorldContextObject, FName Collection, const KeyType& Key, T& OutValue)
+	{
+		UHippocacheSubsystem* Subsystem = nullptr;
+		FHippocacheResult Result = GetSubsystemSafe(WorldContextObject, Subsystem);
+		if (Result.IsError())
+		{
+			return Result;
+		}
+
+		// The type check is a struct pointer compare, and the value is copied out of the cache slot directly
+		if constexpr (THippocachePrimitiveWrapper<T>::bSupported)
+		{
+			using FWrapper = typename THippocachePrimitiveWrapper<T>::Type;
+			return Subsystem->ReadStructTyped<FWrapper>(Collection, Key, [&OutValue](const FWrapper& Wrapper)
+			{
+				OutValue = Wrapper.Value;
+			});
+		}
+		else
+		{
+			return Subsystem->ReadStructTyped<T>(Collection, Key, [&OutValue](const T& Value)
+			{
+				OutValue = Value;
+			});
+		}
+	}
+
+	// Shared body of the atomic numeric functions: runs Operation on the subsystem and unpacks its result
+	template<typename T>
+	static FHippocacheResult NumericImpl(const UObject* WorldContextObject, T& OutValue, TFunctionRef<THippocacheResult<T>(UHippocacheSubsystem& Subsystem)> Operation)
+	{
+		UHippocacheSubsystem* Subsystem = nullptr;
+		FHippocacheResult Result = GetSubsystemSafe(WorldContextObject, Subsystem);
+		if (Result.IsError())
 		{
-			return FHippocacheResult::Error(EHippocacheErrorCode::TypeMismatch, 
-				FString::Printf(TEXT("FVariant type mismatch - got %s"), 
-					*Wrapper->GetTypeName()), 
-				FString::Printf(TEXT("Collection: %s, Key: %s"), *Collection.ToString(), *Key));
+			return Result;
 		}
 
-		OutValue = Wrapper->GetValue<T>();
-		return FHippocacheResult::Success();
+		const THippocacheResult<T> NumericResult = Operation(*Subsystem);
+		OutValue = NumericResult.Value;
+		return NumericResult.Result;
 	}
 
+public:
+
 	// Int32 operations
 	UFUNCTION(BlueprintCallable, Category = "Hippocache", meta = (WorldContext = "WorldContextObject", DisplayName = "Set Int32 With TTL"))
 	static FHippocacheResult SetInt32WithTTL(const UObject* WorldContextObject, FName Collection, const FString& Key, int32 Value, float TTLSeconds);
@@ -221,6 +353,76 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Hippocache", meta = (WorldContext = "WorldContextObject", DisplayName = "Get Double"))
 	static FHippocacheResult GetDouble(const UObject* WorldContextObject, FName Collection, const FString& Key, double& OutValue);
 
+	// ============================================================================
+	// Atomic numeric operations
+	// ============================================================================
+	// Values set with SetInt32/SetInt64/SetFloat/SetDouble can be changed in place, atomically, without a
+	// Get and Set round trip. See UHippocacheSubsystem::Add for how missing keys are handled.
+
+	// Int32 atomic operations
+	UFUNCTION(BlueprintCallable, Category = "Hippocache|Atomic", meta = (WorldContext = "WorldContextObject", DisplayName = "Add Int32"))
+	static FHippocacheResult AddInt32(const UObject* WorldContextObject, FName Collection, const FString& Key, int32 Delta, int32& OutNewValue);
+
+	UFUNCTION(BlueprintCallable, Category = "Hippocache|Atomic", meta = (WorldContext = "WorldContextObject", DisplayName = "Increment Int32"))
+	static FHippocacheResult IncrementInt32(const UObject* WorldContextObject, FName Collection, const FString& Key, int32& OutNewValue);
+
+	UFUNCTION(BlueprintCallable, Category = "Hippocache|Atomic", meta = (WorldContext = "WorldContextObject", DisplayName = "Decrement Int32"))
+	static FHippocacheResult DecrementInt32(const UObject* WorldContextObject, FName Collection, const FString& Key, int32& OutNewValue);
+
+	UFUNCTION(BlueprintCallable, Category = "Hippocache|Atomic", meta = (WorldContext = "WorldContextObject", DisplayName = "Compare And Swap Int32"))
+	static FHippocacheResult CompareAndSwapInt32(const UObject* WorldContextObject, FName Collection, const FString& Key, int32 Expected, int32 Desired, int32& OutPreviousValue, bool& bOutSwapped);
+
+	UFUNCTION(BlueprintCallable, Category = "Hippocache|Atomic", meta = (WorldContext = "WorldContextObject", DisplayName = "Fetch Min Int32"))
+	static FHippocacheResult FetchMinInt32(const UObject* WorldContextObject, FName Collection, const FString& Key, int32 Value, int32& OutPreviousValue);
+
+	UFUNCTION(BlueprintCallable, Category = "Hippocache|Atomic", meta = (WorldContext = "WorldContextObject", DisplayName = "Fetch Max Int32"))
+	static FHippocacheResult FetchMaxInt32(const UObject* WorldContextObject, FName Collection, const FString& Key, int32 Value, int32& OutPreviousValue);
+
+	// Int64 atomic operations
+	UFUNCTION(BlueprintCallable, Category = "Hippocache|Atomic", meta = (WorldContext = "WorldContextObject", DisplayName = "Add Int64"))
+	static FHippocacheResult AddInt64(const UObject* WorldContextObject, FName Collection, const FString& Key, int64 Delta, int64& OutNewValue);
+
+	UFUNCTION(BlueprintCallable, Category = "Hippocache|Atomic", meta = (WorldContext = "WorldContextObject", DisplayName = "Increment Int64"))
+	static FHippocacheResult IncrementInt64(const UObject* WorldContextObject, FName Collection, const FString& Key, int64& OutNewValue);
+
+	UFUNCTION(BlueprintCallable, Category = "Hippocache|Atomic", meta = (WorldContext = "WorldContextObject", DisplayName = "Decrement Int64"))
+	static FHippocacheResult DecrementInt64(const UObject* WorldContextObject, FName Collection, const FString& Key, int64& OutNewValue);
+
+	UFUNCTION(BlueprintCallable, Category = "Hippocache|Atomic", meta = (WorldContext = "WorldContextObject", DisplayName = "Compare And Swap Int64"))
+	static FHippocacheResult CompareAndSwapInt64(const UObject* WorldContextObject, FName Collection, const FString& Key, int64 Expected, int64 Desired, int64& OutPreviousValue, bool& bOutSwapped);
+
+	UFUNCTION(BlueprintCallable, Category = "Hippocache|Atomic", meta = (WorldContext = "WorldContextObject", DisplayName = "Fetch Min Int64"))
+	static FHippocacheResult FetchMinInt64(const UObject* WorldContextObject, FName Collection, const FString& Key, int64 Value, int64& OutPreviousValue);
+
+	UFUNCTION(BlueprintCallable, Category = "Hippocache|Atomic", meta = (WorldContext = "WorldContextObject", DisplayName = "Fetch Max Int64"))
+	static FHippocacheResult FetchMaxInt64(const UObject* WorldContextObject, FName Collection, const FString& Key, int64 Value, int64& OutPreviousValue);
+
+	// Float atomic operations
+	UFUNCTION(BlueprintCallable, Category = "Hippocache|Atomic", meta = (WorldContext = "WorldContextObject", DisplayName = "Add Float"))
+	static FHippocacheResult AddFloat(const UObject* WorldContextObject, FName Collection, const FString& Key, float Delta, float& OutNewValue);
+
+	UFUNCTION(BlueprintCallable, Category = "Hippocache|Atomic", meta = (WorldContext = "WorldContextObject", DisplayName = "Compare And Swap Float"))
+	static FHippocacheResult CompareAndSwapFloat(const UObject* WorldContextObject, FName Collection, const FString& Key, float Expected, float Desired, float& OutPreviousValue, bool& bOutSwapped);
+
+	UFUNCTION(BlueprintCallable, Category = "Hippocache|Atomic", meta = (WorldContext = "WorldContextObject", DisplayName = "Fetch Min Float"))
+	static FHippocacheResult FetchMinFloat(const UObject* WorldContextObject, FName Collection, const FString& Key, float Value, float& OutPreviousValue);
+
+	UFUNCTION(BlueprintCallable, Category = "Hippocache|Atomic", meta = (WorldContext = "WorldContextObject", DisplayName = "Fetch Max Float"))
+	static FHippocacheResult FetchMaxFloat(const UObject* WorldContextObject, FName Collection, const FString& Key, float Value, float& OutPreviousValue);
+
+	// Double atomic operations
+	UFUNCTION(BlueprintCallable, Category = "Hippocache|Atomic", meta = (WorldContext = "WorldContextObject", DisplayName = "Add Double"))
+	static FHippocacheResult AddDouble(const UObject* WorldContextObject, FName Collection, const FString& Key, double Delta, double& OutNewValue);
+
+	UFUNCTION(BlueprintCallable, Category = "Hippocache|Atomic", meta = (WorldContext = "WorldContextObject", DisplayName = "Compare And Swap Double"))
+	static FHippocacheResult CompareAndSwapDouble(const UObject* WorldContextObject, FName Collection, const FString& Key, double Expected, double Desired, double& OutPreviousValue, bool& bOutSwapped);
+
+	UFUNCTION(BlueprintCallable, Category = "Hippocache|Atomic", meta = (WorldContext = "WorldContextObject", DisplayName = "Fetch Min Double"))
+	static FHippocacheResult FetchMinDouble(const UObject* WorldContextObject, FName Collection, const FString& Key, double Value, double& OutPreviousValue);
+
+	UFUNCTION(BlueprintCallable, Category = "Hippocache|Atomic", meta = (WorldContext = "WorldContextObject", DisplayName = "Fetch Max Double"))
+	static FHippocacheResult FetchMaxDouble(const UObject* WorldContextObject, FName Collection, const FString& Key, double Value, double& OutPreviousValue);
+
 	// String operations
 	UFUNCTION(BlueprintCallable, Category = "Hippocache", meta = (WorldContext = "WorldContextObject", DisplayName = "Set String With TTL"))
 	static FHippocacheResult SetStringWithTTL(const UObject* WorldContextObject, FName Collection, const FString& Key, const FString& Value, float TTLSeconds);
@@ -408,10 +610,70 @@ public:
 		return HippopImpl<T>(WorldContextObject, Collection, Key, OutValue);
 	}
 
+	/** Hippoo with a precomputed FHippocacheKey. */
+	template<typename T>
+	static FHippocacheResult Hippoo(const UObject* WorldContextObject, FName Collection, const FHippocacheKey& Key, const T& Value)
+	{
+		return HippooImpl<T>(WorldContextObject, Collection, Key, Value);
+	}
+
+	/** Hippoo with TTL and a precomputed FHippocacheKey. */
+	template<typename T>
+	static FHippocacheResult Hippoo(const UObject* WorldContextObject, FName Collection, const FHippocacheKey& Key, const T& Value, float TTLSeconds)
+	{
+		return HippooImplWithTTL<T>(WorldContextObject, Collection, Key, Value, TTLSeconds);
+	}
+
+	/** Hippop with a precomputed FHippocacheKey. */
+	template<typename T>
+	static FHippocacheResult Hippop(const UObject* WorldContextObject, FName Collection, const FHippocacheKey& Key, T& OutValue)
+	{
+		return HippopImpl<T>(WorldContextObject, Collection, Key, OutValue);
+	}
+
+	/**
+	 * Hippoo overloads for temporaries and MoveTemp'd values: structs are moved into the cache instead of copied.
+	 * Primitives are small and take the regular path.
+	 */
+	template<typename T, typename = THippocacheMovableValue<T>>
+	static FHippocacheResult Hippoo(const UObject* WorldContextObject, FName Collection, const FString& Key, T&& Value)
+	{
+		return HippooMoveImpl<T>(WorldContextObject, Collection, Key, MoveTemp(Value), 0.0f);
+	}
+
+	template<typename T, typename = THippocacheMovableValue<T>>
+	static FHippocacheResult Hippoo(const UObject* WorldContextObject, FName Collection, const FString& Key, T&& Value, float TTLSeconds)
+	{
+		return HippooMoveImpl<T>(WorldContextObject, Collection, Key, MoveTemp(Value), TTLSeconds);
+	}
+
+	template<typename T, typename = THippocacheMovableValue<T>>
+	static FHippocacheResult Hippoo(const UObject* WorldContextObject, FName Collection, const FHippocacheKey& Key, T&& Value)
+	{
+		return HippooMoveImpl<T>(WorldContextObject, Collection, Key, MoveTemp(Value), 0.0f);
+	}
+
+	template<typename T, typename = THippocacheMovableValue<T>>
+	static FHippocacheResult Hippoo(const UObject* WorldContextObject, FName Collection, const FHippocacheKey& Key, T&& Value, float TTLSeconds)
+	{
+		return HippooMoveImpl<T>(WorldContextObject, Collection, Key, MoveTemp(Value), TTLSeconds);
+	}
+
 	// Cache management operations
 	UFUNCTION(BlueprintCallable, Category = "Hippocache", meta = (WorldContext = "WorldContextObject", DisplayName = "Remove Item"))
 	static FHippocacheResult Remove(const UObject* WorldContextObject, FName Collection, const FString& Key);
 
+	// Remove with a precomputed FHippocacheKey (C++ only)
+	static FHippocacheResult Remove(const UObject* WorldContextObject, FName Collection, const FHippocacheKey& Key);
+
+	/**
+	 * Builds a key whose hash is computed once, for the "By Key" nodes
+	 * @param Key - The key string
+	 * @return A key that can be reused across calls without rehashing
+	 */
+	UFUNCTION(BlueprintPure, Category = "Hippocache|Key", meta = (DisplayName = "Make Hippocache Key"))
+	static FHippocacheKey MakeHippocacheKey(const FString& Key);
+
 	UFUNCTION(BlueprintCallable, Category = "Hippocache", meta = (WorldContext = "WorldContextObject", DisplayName = "Clear Collection"))
 	static FHippocacheResult Clear(const UObject* WorldContextObject, FName Collection);
 
@@ -494,6 +756,16 @@ public:
 	UFUNCTION(BlueprintPure, Category = "Hippocache|Result", meta = (DisplayName = "Describe Result"))
 	static FString DescribeResult(const FHippocacheResult& Result);
 
+	/**
+	 * Breaks a result into its fields. This is the result's Break node, so misses are formatted only here
+	 * @param Result - The result to break
+	 * @param ErrorCode - The error code
+	 * @param ErrorMessage - The error message
+	 * @param ErrorContext - The error context
+	 */
+	UFUNCTION(BlueprintPure, Category = "Hippocache|Result", meta = (DisplayName = "Break Hippocache Result"))
+	static void BreakHippocacheResult(const FHippocacheResult& Result, EHippocacheErrorCode& ErrorCode, FString& ErrorMessage, FString& ErrorContext);
+
 	// ============================================================================
 	// CustomThunk Blueprint Universal Functions - Hippoo & Hippop
 	// ============================================================================
@@ -535,6 +807,43 @@ public:
 	static FHippocacheResult HippopBlueprint(const UObject* WorldContextObject, FName Collection, const FString& Key, int32& OutValue);
 	DECLARE_FUNCTION(execHippopBlueprint);
 
+	/**
+	 * Hippoo (Set) with a key from Make Hippocache Key - skips hashing the key string on every call
+	 * @param WorldContextObject - World context for subsystem access
+	 * @param Collection - Collection name to store in
+	 * @param Key - Precomputed key to store the value under
+	 * @param Value - Value to store (type automatically detected)
+	 * @return Result indicating success or failure
+	 */
+	UFUNCTION(BlueprintCallable, CustomThunk, Category = "Hippocache|Universal", meta = (WorldContext = "WorldContextObject", DisplayName = "Hippoo By Key (Set)", CustomStructureParam = "Value", CallInEditor = "true"))
+	static FHippocacheResult HippooByKey(const UObject* WorldContextObject, FName Collection, const FHippocacheKey& Key, const int32& Value);
+	DECLARE_FUNCTION(execHippooByKey);
+
+	/**
+	 * Hippoo With TTL (Set) with a key from Make Hippocache Key
+	 * @param WorldContextObject - World context for subsystem access
+	 * @param Collection - Collection name to store in
+	 * @param Key - Precomputed key to store the value under
+	 * @param Value - Value to store (type automatically detected)
+	 * @param TTLSeconds - Time to live in seconds
+	 * @return Result indicating success or failure
+	 */
+	UFUNCTION(BlueprintCallable, CustomThunk, Category = "Hippocache|Universal", meta = (WorldContext = "WorldContextObject", DisplayName = "Hippoo By Key With TTL (Set)", CustomStructureParam = "Value", CallInEditor = "true"))
+	static FHippocacheResult HippooByKeyWithTTL(const UObject* WorldContextObject, FName Collection, const FHippocacheKey& Key, const int32& Value, float TTLSeconds);
+	DECLARE_FUNCTION(execHippooByKeyWithTTL);
+
+	/**
+	 * Hippop (Get) with a key from Make Hippocache Key
+	 * @param WorldContextObject - World context for subsystem access
+	 * @param Collection - Collection name to retrieve from
+	 * @param Key - Precomputed key to retrieve the value from
+	 * @param OutValue - Reference to store the retrieved value (type automatically detected)
+	 * @return Result indicating success or failure
+	 */
+	UFUNCTION(BlueprintCallable, CustomThunk, Category = "Hippocache|Universal", meta = (WorldContext = "WorldContextObject", DisplayName = "Hippop By Key (Get)", CustomStructureParam = "OutValue", CallInEditor = "true"))
+	static FHippocacheResult HippopByKey(const UObject* WorldContextObject, FName Collection, const FHippocacheKey& Key, int32& OutValue);
+	DECLARE_FUNCTION(execHippopByKey);
+
 	// FInstancedStruct functions for Blueprint struct support
 	
 	/**
@@ -573,13 +882,16 @@ public:
 
 
 private:
+	// The spec drives the property helpers directly, since a CustomThunk can only be reached from Blueprint bytecode
+	friend class FHippocacheBlueprintLibrarySpec;
+
 	// Helper functions for CustomThunk implementation
-	static FHippocacheResult ExecuteHippooForProperty(const UObject* WorldContextObject, FName Collection, const FString& Key, FProperty* ValueProperty, void* ValuePtr, float TTLSeconds, bool bUseTTL);
-	static FHippocacheResult ExecuteHippopForProperty(const UObject* WorldContextObject, FName Collection, const FString& Key, FProperty* ValueProperty, void* ValuePtr);
+	static FHippocacheResult ExecuteHippooForProperty(const UObject* WorldContextObject, FName Collection, const FHippocacheKey& Key, FProperty* ValueProperty, void* ValuePtr, float TTLSeconds, bool bUseTTL);
+	static FHippocacheResult ExecuteHippopForProperty(const UObject* WorldContextObject, FName Collection, const FHippocacheKey& Key, FProperty* ValueProperty, void* ValuePtr);
 
 	// Internal implementation functions for universal setter/getter
-	template<typename T>
-	static FHippocacheResult HippooImpl(const UObject* WorldContextObject, FName Collection, const FString& Key, const T& Value)
+	template<typename T, typename KeyType>
+	static FHippocacheResult HippooImpl(const UObject* WorldContextObject, FName Collection, const KeyType& Key, const T& Value)
 	{
 		// Runtime type detection using Unreal's reflection system
 		if constexpr (std::is_same_v<T, UObject*> || std::is_base_of_v<UObject, std::remove_pointer_t<T>>)
@@ -601,7 +913,7 @@ private:
 			}
 			else
 			{
-				// This is a primitive type - use variant storage
+				// This is a primitive type - its storage struct is picked at compile time by SetPrimitive
 				UE_LOG(LogTemp, VeryVerbose, TEXT("Hippoo: Storing as primitive - Collection: %s, Key: %s"), 
 					*Collection.ToString(), *Key);
 				return SetPrimitive<T>(WorldContextObject, Collection, Key, Value);
@@ -609,8 +921,8 @@ private:
 		}
 	}
 	
-	template<typename T>
-	static FHippocacheResult HippooImplWithTTL(const UObject* WorldContextObject, FName Collection, const FString& Key, const T& Value, float TTLSeconds)
+	template<typename T, typename KeyType>
+	static FHippocacheResult HippooImplWithTTL(const UObject* WorldContextObject, FName Collection, const KeyType& Key, const T& Value, float TTLSeconds)
 	{
 		// Runtime type detection using Unreal's reflection system
 		if constexpr (std::is_same_v<T, UObject*> || std::is_base_of_v<UObject, std::remove_pointer_t<T>>)
@@ -632,16 +944,32 @@ private:
 			}
 			else
 			{
-				// This is a primitive type - use variant storage with TTL
+				// This is a primitive type - its storage struct is picked at compile time by SetPrimitive
 				UE_LOG(LogTemp, VeryVerbose, TEXT("Hippoo TTL: Storing as primitive - Collection: %s, Key: %s, TTL: %.2fs"), 
 					*Collection.ToString(), *Key, TTLSeconds);
 				return SetPrimitiveWithTTL<T>(WorldContextObject, Collection, Key, Value, TTLSeconds);
 			}
 		}
 	}
+
+	template<typename T, typename KeyType>
+	static FHippocacheResult HippooMoveImpl(const UObject* WorldContextObject, FName Collection, const KeyType& Key, T&& Value, float TTLSeconds)
+	{
+		if constexpr (requires { T::StaticStruct(); })
+		{
+			UE_LOG(LogTemp, VeryVerbose, TEXT("Hippoo: Moving struct into cache - Collection: %s, Key: %s, Type: %s"), 
+				*Collection.ToString(), *Key, *T::StaticStruct()->GetName());
+			return SetStructWithTTL<T>(WorldContextObject, Collection, Key, MoveTemp(Value), TTLSeconds);
+		}
+		else
+		{
+			// Primitives (and rejected types) gain nothing from a move
+			return HippooImplWithTTL<T>(WorldContextObject, Collection, Key, Value, TTLSeconds);
+		}
+	}
 	
-	template<typename T>
-	static FHippocacheResult HippopImpl(const UObject* WorldContextObject, FName Collection, const FString& Key, T& OutValue)
+	template<typename T, typename KeyType>
+	static FHippocacheResult HippopImpl(const UObject* WorldContextObject, FName Collection, const KeyType& Key, T& OutValue)
 	{
 		// Runtime type detection using Unreal's reflection system
 		if constexpr (std::is_same_v<T, UObject*> || std::is_base_of_v<UObject, std::remove_pointer_t<T>>)
@@ -669,7 +997,7 @@ private:
 			}
 			else
 			{
-				// This is a primitive type - use variant retrieval
+				// This is a primitive type - GetPrimitive checks the stored struct pointer, no value is built
 				UE_LOG(LogTemp, VeryVerbose, TEXT("Hippop: Retrieving as primitive - Collection: %s, Key: %s"), 
 					*Collection.ToString(), *Key);
 				return GetPrimitive<T>(WorldContextObject, Collection, Key, OutValue);
@@ -677,11 +1005,4 @@ private:
 		}
 	}
 
-private:
-	// Helper function to convert FProperty values to FVariant
-	static bool PropertyToVariant(FProperty* Property, void* ValuePtr, FVariant& OutVariant);
-	
-	// Helper function to extract FVariant values back to FProperty
-	static bool VariantToProperty(const FVariant& Variant, FProperty* Property, void* ValuePtr);
-
 };
\ No newline at end of file
@@ -0,0 +1,39 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * @brief The time base of item expiration: FPlatformTime::Cycles64() ticks.
+ *
+ * A write turns its TTL into one absolute deadline, so checking an item is a single integer compare
+ * against a clock reading. Readings are taken once per operation, or once per pass by the sweeps and
+ * visitors that check many items, rather than once per item.
+ */
+struct FHippocacheClock
+{
+	/** Deadline of an item that never expires. */
+	static constexpr uint64 Never = 0;
+
+	/** Gets the current time. */
+	static uint64 Now() { return FPlatformTime::Cycles64(); }
+
+	/** Gets the deadline of an item written at Time with TTL, or Never if TTL isn't positive. */
+	static uint64 Deadline(uint64 Time, FTimespan TTL)
+	{
+		if (TTL <= FTimespan::Zero())
+		{
+			return Never;
+		}
+		const double Cycles = FMath::Max(TTL.GetTotalSeconds() / FPlatformTime::GetSecondsPerCycle64(), 1.0);
+		return Time + static_cast<uint64>(FMath::Min(Cycles, static_cast<double>(MAX_int64)));
+	}
+
+	/** Whether a Deadline has passed at Time. */
+	static bool HasPassed(uint64 Deadline, uint64 Time) { return Deadline != Never && Time > Deadline; }
+
+	/** Whether a Deadline has passed now. Only reads the clock when there is a deadline. */
+	static bool HasPassed(uint64 Deadline) { return Deadline != Never && Now() > Deadline; }
+
+	/** Converts a clock reading to seconds. Readings count from their own origin, not FPlatformTime::Seconds()'s. */
+	static double ToSeconds(uint64 Time) { return FPlatformTime::ToSeconds64(Time); }
+};
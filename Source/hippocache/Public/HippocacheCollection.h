@@ -0,0 +1,838 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/CriticalSection.h"
+#include "Misc/ScopeRWLock.h"
+#include <atomic>
+#include "Runtime/Launch/Resources/Version.h"
+
+// Version-specific includes for StructUtils
+#if ENGINE_MAJOR_VERSION >= 5 && ENGINE_MINOR_VERSION >= 4
+#include "StructUtils/InstancedStruct.h"
+#else
+#include "InstancedStruct.h"
+#endif
+
+#include "HippocacheResult.h"
+#include "HippocacheKey.h"
+#include "HippocacheClock.h"
+#include "HippocacheCollection.generated.h"
+
+class FHippocacheSlabAllocator;
+class FHippocacheTimingWheel;
+struct FHippocacheExpiryRecord;
+
+/**
+ * @brief Represents a single cached item.
+ * Small plain-old-data structs (FVector, FRotator, FGuid, ...) are stored inline in InlineData, so
+ * setting and reading them never touches the allocator. Collections construct larger values directly
+ * in memory they provide (External). A value handed over as an FInstancedStruct rvalue keeps its
+ * allocation and is stored in Value.
+ */
+USTRUCT()
+struct FCachedItem
+{
+	GENERATED_BODY()
+
+	/** The cached data, when it was adopted from an FInstancedStruct or built without external memory. */
+	UPROPERTY()
+	FInstancedStruct Value;
+
+	/** FHippocacheClock time after which the item has expired, or FHippocacheClock::Never. */
+	UPROPERTY()
+	uint64 Deadline = FHippocacheClock::Never;
+
+	// TODO: Memory features - disabled for now, implement later
+	/** Last access time for LRU eviction, in FHippocacheClock time */
+	mutable uint64 LastAccessTime = 0;
+
+	/** Estimated memory size in bytes */
+	// int64 EstimatedSizeBytes;
+
+	/** Largest value, in bytes, stored inline instead of in Value. */
+	static constexpr int32 InlineCapacity = 32;
+
+	/** Type of the value in InlineData, or nullptr when the value is stored elsewhere. */
+	const UScriptStruct* InlineStruct = nullptr;
+
+	/** Inline value storage, used when CanStoreInline(type). */
+	alignas(16) uint8 InlineData[InlineCapacity];
+
+	/** Type of the value at ExternalData, or nullptr. */
+	const UScriptStruct* ExternalStruct = nullptr;
+
+	/** Value constructed in memory owned by the collection. The item destroys the value but never frees the memory. */
+	uint8* ExternalData = nullptr;
+
+	/** Default constructor. */
+	FCachedItem()
+		// : EstimatedSizeBytes(0)
+	{}
+
+	/** Constructor for any type stored as FInstancedStruct. */
+	FCachedItem(const FInstancedStruct& InValue, FTimespan InTTL)
+		: FCachedItem(InValue.GetScriptStruct(), InValue.GetMemory(), InTTL)
+	{}
+
+	/**
+	 * Constructor copying a value of type InStruct from InMemory.
+	 * @param InExternalData If set, and the value can't be stored inline, the value is constructed here
+	 * instead of in Value. Must hold InStruct's size and alignment, and outlive the item.
+	 */
+	FCachedItem(const UScriptStruct* InStruct, const void* InMemory, FTimespan InTTL, uint8* InExternalData = nullptr)
+	{
+		RestartTTL(InTTL);
+		if (InExternalData && !CanStoreInline(InStruct))
+		{
+			InStruct->InitializeStruct(InExternalData);
+			InStruct->CopyScriptStruct(InExternalData, InMemory);
+			ExternalStruct = InStruct;
+			ExternalData = InExternalData;
+		}
+		else
+		{
+			SetValue(InStruct, InMemory);
+		}
+	}
+
+	/**
+	 * Constructor building the value in place: Construct must construct an InStruct in the uninitialized
+	 * memory it's given, which is InlineData when the type can be stored inline and InExternalData otherwise.
+	 */
+	FCachedItem(const UScriptStruct* InStruct, TFunctionRef<void(void* Memory)> Construct, FTimespan InTTL, uint8* InExternalData)
+	{
+		RestartTTL(InTTL);
+		if (CanStoreInline(InStruct))
+		{
+			Construct(InlineData);
+			InlineStruct = InStruct;
+		}
+		else
+		{
+			check(InExternalData);
+			Construct(InExternalData);
+			ExternalStruct = InStruct;
+			ExternalData = InExternalData;
+		}
+	}
+
+	/** Constructor taking over InValue. Only inline values are copied; anything else keeps InValue's allocation. */
+	FCachedItem(FInstancedStruct&& InValue, FTimespan InTTL)
+	{
+		RestartTTL(InTTL);
+		if (CanStoreInline(InValue.GetScriptStruct()))
+		{
+			SetValue(InValue.GetScriptStruct(), InValue.GetMemory());
+		}
+		else
+		{
+			Value = MoveTemp(InValue);
+		}
+	}
+
+	~FCachedItem()
+	{
+		if (ExternalStruct)
+		{
+			ExternalStruct->DestroyStruct(ExternalData);
+		}
+	}
+
+	/** Not copyable: an external value has a single owner. */
+	FCachedItem(const FCachedItem&) = delete;
+	FCachedItem& operator=(const FCachedItem&) = delete;
+
+	/** Whether values of Struct are stored inline: plain old data (copyable with memcpy) that fits InlineData. */
+	static bool CanStoreInline(const UScriptStruct* Struct)
+	{
+		return Struct
+			&& (Struct->StructFlags & STRUCT_IsPlainOldData) != 0
+			&& Struct->GetStructureSize() <= InlineCapacity
+			&& Struct->GetMinAlignment() <= alignof(FCachedItem);
+	}
+
+	/** Whether the value is stored inline. */
+	bool IsInline() const { return InlineStruct != nullptr; }
+
+	/** Whether the value lives in external memory. */
+	bool IsExternal() const { return ExternalStruct != nullptr; }
+
+	/** Gets the type of the stored value, or nullptr if there is none. */
+	const UScriptStruct* GetScriptStruct() const { return InlineStruct ? InlineStruct : ExternalStruct ? ExternalStruct : Value.GetScriptStruct(); }
+
+	/** Gets the stored value's memory, or nullptr if there is none. */
+	const uint8* GetMemory() const { return InlineStruct ? InlineData : ExternalStruct ? ExternalData : Value.GetMemory(); }
+	uint8* GetMutableMemory() { return InlineStruct ? InlineData : ExternalStruct ? ExternalData : Value.GetMutableMemory(); }
+
+	/** Replaces the stored value with a copy of InMemory, inline when the type allows it. Not for external items. */
+	void SetValue(const UScriptStruct* InStruct, const void* InMemory)
+	{
+		check(!ExternalStruct);
+		if (CanStoreInline(InStruct))
+		{
+			Value.Reset();
+			InlineStruct = InStruct;
+			FMemory::Memcpy(InlineData, InMemory, InStruct->GetStructureSize());
+		}
+		else
+		{
+			InlineStruct = nullptr;
+			Value.InitializeAs(InStruct, static_cast<const uint8*>(InMemory));
+		}
+	}
+
+	/**
+	 * Replaces the value with one built by Construct in the memory the current value occupies, and restarts
+	 * the TTL as if the item were newly created. Only possible when an inline value is replaced by another
+	 * inline value, or a non-inline value by one of the same type; otherwise returns false and changes nothing.
+	 */
+	bool ReconstructInPlace(const UScriptStruct* InStruct, TFunctionRef<void(void* Memory)> Construct, FTimespan InTTL)
+	{
+		if (IsInline() && CanStoreInline(InStruct))
+		{
+			Construct(InlineData);
+			InlineStruct = InStruct;
+		}
+		else if (!IsInline() && InStruct == GetScriptStruct())
+		{
+			uint8* Memory = ExternalStruct ? ExternalData : Value.GetMutableMemory();
+			InStruct->DestroyStruct(Memory);
+			Construct(Memory);
+		}
+		else
+		{
+			return false;
+		}
+		RestartTTL(InTTL);
+		return true;
+	}
+
+	/** Starts the item's lifetime over: it expires InTTL from now, reading the clock once. */
+	void RestartTTL(FTimespan InTTL)
+	{
+		LastAccessTime = FHippocacheClock::Now();
+		Deadline = FHippocacheClock::Deadline(LastAccessTime, InTTL);
+	}
+
+	/** Constructs a copy of the Struct value at Source in the uninitialized memory at Dest. */
+	static void CopyConstruct(const UScriptStruct* Struct, void* Dest, const void* Source)
+	{
+		if (Struct->StructFlags & STRUCT_IsPlainOldData)
+		{
+			FMemory::Memcpy(Dest, Source, Struct->GetStructureSize());
+		}
+		else
+		{
+			Struct->InitializeStruct(Dest);
+			Struct->CopyScriptStruct(Dest, Source);
+		}
+	}
+
+	/** Checks whether an item with InDeadline has expired at Now, an FHippocacheClock reading. */
+	static bool HasExpired(uint64 InDeadline, uint64 Now)
+	{
+		return FHippocacheClock::HasPassed(InDeadline, Now);
+	}
+
+	/** Checks if the item has expired at Now. */
+	bool HasExpired(uint64 Now) const
+	{
+		return HasExpired(Deadline, Now);
+	}
+
+	/** Checks if the item has expired, reading the clock only if it has a deadline. */
+	bool HasExpired() const
+	{
+		return FHippocacheClock::HasPassed(Deadline);
+	}
+
+	/** Updates last access time */
+	void UpdateAccessTime() const
+	{
+		LastAccessTime = FHippocacheClock::Now();
+	}
+
+	/** Get time since last access */
+	double GetTimeSinceLastAccess() const
+	{
+		return FHippocacheClock::ToSeconds(FHippocacheClock::Now() - LastAccessTime);
+	}
+};
+
+template<>
+struct TStructOpsTypeTraits<FCachedItem> : public TStructOpsTypeTraitsBase2<FCachedItem>
+{
+	enum
+	{
+		WithCopy = false,
+	};
+};
+
+/**
+ * @brief Index structure backing a collection's entries.
+ */
+UENUM(BlueprintType)
+enum class EHippocacheIndexType : uint8
+{
+	FlatTable,	// Swiss-style open-addressing table with lock-free reads (default)
+	TMap		// TMap keyed by FString; reads take the shard read lock
+};
+
+/**
+ * @brief Where a collection allocates its entries and value payloads.
+ */
+UENUM(BlueprintType)
+enum class EHippocacheValueAllocator : uint8
+{
+	Heap,	// Each entry, together with its value, is one global heap allocation (default)
+	Slab	// Per-shard size-class slabs; Clear releases whole pages instead of freeing item by item
+};
+
+/**
+ * @brief Per-collection settings, fixed when the collection is created.
+ */
+USTRUCT(BlueprintType)
+struct HIPPOCACHE_API FHippocacheCollectionOptions
+{
+	GENERATED_BODY()
+
+	/** Index structure used to look up entries. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Hippocache")
+	EHippocacheIndexType IndexType = EHippocacheIndexType::FlatTable;
+
+	/** Number of lock shards (rounded up to a power of two). 0 uses the subsystem's ShardCount. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Hippocache", meta = (ClampMin = "0", ClampMax = "1024"))
+	int32 ShardCount = 0;
+
+	/** Allocator for entries and value payloads. Slab suits long-lived collections that churn through many items. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Hippocache")
+	EHippocacheValueAllocator ValueAllocator = EHippocacheValueAllocator::Heap;
+
+	/**
+	 * Pins the collection to one struct type. Values are then stored back to back in dense per-shard
+	 * arrays instead of as individual entries, and setting any other type fails with TypeMismatch.
+	 * IndexType and ValueAllocator don't apply to typed collections.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Hippocache")
+	TObjectPtr<UScriptStruct> ValueType = nullptr;
+};
+
+/**
+ * @brief Limits for one step of the incremental expiration sweep (see FHippocacheCollection::SweepExpired).
+ */
+struct FHippocacheSweepBudget
+{
+	/** Expiry records the step may still process. Counted down as the sweep goes. */
+	int32 ItemsLeft = 0;
+
+	/** FPlatformTime::Seconds() at which the step stops. */
+	double EndTime = 0.0;
+
+	/** Longest the sweep may hold a shard lock at a time, in seconds. */
+	double MaxLockSeconds = 0.0;
+};
+
+/**
+ * @brief What one step of the incremental expiration sweep did.
+ */
+USTRUCT(BlueprintType)
+struct HIPPOCACHE_API FHippocacheSweepStats
+{
+	GENERATED_BODY()
+
+	/** Due expiry records processed, including those of items since overwritten or removed. */
+	UPROPERTY(BlueprintReadOnly, Category = "Hippocache")
+	int32 ItemsExamined = 0;
+
+	/** Expired items removed. */
+	UPROPERTY(BlueprintReadOnly, Category = "Hippocache")
+	int32 ItemsRemoved = 0;
+
+	/** Times a shard lock was taken. */
+	UPROPERTY(BlueprintReadOnly, Category = "Hippocache")
+	int32 LockHolds = 0;
+
+	/** Collections the sweep finished a full pass over. */
+	UPROPERTY(BlueprintReadOnly, Category = "Hippocache")
+	int32 CollectionsCompleted = 0;
+
+	/** Longest single shard lock hold, in seconds. */
+	UPROPERTY(BlueprintReadOnly, Category = "Hippocache")
+	double LongestLockHoldSeconds = 0.0;
+
+	/** Wall time of the whole step, in seconds. */
+	UPROPERTY(BlueprintReadOnly, Category = "Hippocache")
+	double DurationSeconds = 0.0;
+};
+
+/**
+ * @brief A cache entry.
+ *
+ * In a flat-table collection, entries holding a heap value are immutable once visible to readers:
+ * overwriting the key publishes a new entry and retires the old one through FHippocacheEpoch, so
+ * lock-free readers can copy from an entry without any lock. An inline value overwritten by another
+ * inline value is instead rewritten in place inside a Sequence write section, and lock-free readers
+ * retry their copy if Sequence changed under them. UpdateInline rewrites inline values the same way,
+ * but without the shard lock, so writers claim the section through Sequence itself. In a TMap collection, entries are only touched
+ * under the shard lock and are updated in place.
+ *
+ * An entry and its non-inline value share one allocation, with the value constructed right after the
+ * entry (see FHippocacheCollection::CreateEntry). In a slab-backed collection that allocation is a slab block.
+ */
+struct FHippocacheEntry
+{
+	/** The key as originally supplied. */
+	FString Key;
+
+	/** Precomputed FHippocacheKey::HashString(Key). */
+	uint64 Hash = 0;
+
+	/** Odd while an inline value is being rewritten in place. */
+	std::atomic<uint32> Sequence { 0 };
+
+	/** Whether the entry is a slab block rather than a global heap allocation. */
+	bool bSlabAllocated = false;
+
+	/** Deadline a reader last queued the entry's removal for, so one expired item is queued only once. */
+	mutable std::atomic<uint64> QueuedDeadline { FHippocacheClock::Never };
+
+	/** Deadline of the expiry record scheduled for the item, or Never if it has none. Guarded by the shard lock. */
+	uint64 ScheduledDeadline = FHippocacheClock::Never;
+
+	/** The cached value and its expiration data. */
+	FCachedItem Item;
+
+	FHippocacheEntry(const FString& InKey, uint64 InHash, const UScriptStruct* InStruct, TFunctionRef<void(void* Memory)> Construct, FTimespan InTTL, uint8* InExternalData)
+		: Key(InKey)
+		, Hash(InHash)
+		, Item(InStruct, Construct, InTTL, InExternalData)
+	{}
+
+	FHippocacheEntry(const FString& InKey, uint64 InHash, FInstancedStruct&& InValue, FTimespan InTTL)
+		: Key(InKey)
+		, Hash(InHash)
+		, Item(MoveTemp(InValue), InTTL)
+	{}
+};
+
+/**
+ * @brief Storage for a single named collection.
+ *
+ * Every collection owns its own shards, so a writer in one collection never blocks a reader in
+ * another. Writers always serialize on the shard lock. How readers find an entry depends on the
+ * index type:
+ *   - FlatTable: a Swiss-style open-addressing table. One control byte per slot holds 7 bits of
+ *     the key hash, and a whole 16-slot group is matched at once (SSE2 where available), so most
+ *     misses and hits touch a single cache line before the entry itself. The table is published
+ *     atomically and read without any lock; FHippocacheEpoch keeps entries and tables alive.
+ *   - TMap: a TMap<FString, FHippocacheEntry*> per shard, read under the shard read lock. Kept
+ *     for comparison and for workloads dominated by writes.
+ * Keys compare case-insensitively in both, like TMap<FString, ...>.
+ * Entries come from the global heap, or, with EHippocacheValueAllocator::Slab, from a slab per shard.
+ * Items written with a TTL are also scheduled in a per-shard FHippocacheTimingWheel, which SweepExpired drains.
+ * A reader that finds an item expired queues its removal for the shard's next writer instead of removing it.
+ * A typed collection (one pinned ValueType) skips entries altogether: see FTypedStore.
+ * Argument validation (None collection, empty key, invalid value) is done by the caller.
+ */
+class HIPPOCACHE_API FHippocacheCollection
+{
+public:
+	/**
+	 * @param InName Collection name, used for error context.
+	 * @param InShardCount Number of lock shards. Must be a power of two.
+	 * @param InIndexType Index structure backing the shards.
+	 * @param InValueAllocator Allocator for entries and value payloads.
+	 * @param InValueType If set, the only struct type the collection accepts, stored densely.
+	 */
+	FHippocacheCollection(FName InName, int32 InShardCount, EHippocacheIndexType InIndexType = EHippocacheIndexType::FlatTable,
+		EHippocacheValueAllocator InValueAllocator = EHippocacheValueAllocator::Heap, const UScriptStruct* InValueType = nullptr);
+	~FHippocacheCollection();
+
+	FHippocacheCollection(const FHippocacheCollection&) = delete;
+	FHippocacheCollection& operator=(const FHippocacheCollection&) = delete;
+
+	/** Gets the collection name. */
+	FName GetName() const { return Name; }
+
+	/** Gets the index structure backing this collection. */
+	EHippocacheIndexType GetIndexType() const { return IndexType; }
+
+	/** Gets the allocator backing this collection's entries. */
+	EHippocacheValueAllocator GetValueAllocator() const { return ValueAllocator; }
+
+	/** Gets the struct type a typed collection is pinned to, or nullptr for a collection of mixed types. */
+	const UScriptStruct* GetValueType() const { return ValueType; }
+
+	/** Gets the number of lock shards. */
+	int32 GetShardCount() const { return Shards.Num(); }
+
+	/** Whether the owning subsystem has removed this collection. Handles to it stop working once set. */
+	bool IsDestroyed() const { return bDestroyed.load(std::memory_order_acquire); }
+
+	/** Marks the collection removed. Called by the owning subsystem before it drops the collection. */
+	void MarkDestroyed() { bDestroyed.store(true, std::memory_order_release); }
+
+	/**
+	 * @brief Stores a value under Key, replacing any existing item.
+	 * @param KeyHash Must be FHippocacheKey::HashString(Key).
+	 */
+	FHippocacheResult Set(const FString& Key, uint64 KeyHash, const FInstancedStruct& Value, FTimespan TTL) { return Set(Key, KeyHash, Value.GetScriptStruct(), Value.GetMemory(), TTL); }
+	FHippocacheResult Set(const FHippocacheKey& Key, const FInstancedStruct& Value, FTimespan TTL) { return Set(Key.GetKey(), Key.GetHash(), Value, TTL); }
+	FHippocacheResult Set(const FString& Key, const FInstancedStruct& Value, FTimespan TTL) { return Set(Key, FHippocacheKey::HashString(Key), Value, TTL); }
+
+	/**
+	 * @brief Stores a copy of a Struct value read from Memory. Small plain-old-data values go inline,
+	 * and overwriting one inline value with another allocates nothing.
+	 * @param KeyHash Must be FHippocacheKey::HashString(Key).
+	 */
+	FHippocacheResult Set(const FString& Key, uint64 KeyHash, const UScriptStruct* Struct, const void* Memory, FTimespan TTL);
+
+	/**
+	 * @brief Stores Value by taking over its allocation instead of copying it, leaving Value empty.
+	 * Values that end up inline or in a typed collection's dense storage are copied, and Value is left as is.
+	 * @param KeyHash Must be FHippocacheKey::HashString(Key).
+	 */
+	FHippocacheResult Set(const FString& Key, uint64 KeyHash, FInstancedStruct&& Value, FTimespan TTL);
+	FHippocacheResult Set(const FHippocacheKey& Key, FInstancedStruct&& Value, FTimespan TTL) { return Set(Key.GetKey(), Key.GetHash(), MoveTemp(Value), TTL); }
+	FHippocacheResult Set(const FString& Key, FInstancedStruct&& Value, FTimespan TTL) { return Set(Key, FHippocacheKey::HashString(Key), MoveTemp(Value), TTL); }
+
+	/**
+	 * @brief Stores a Struct value that Construct builds directly in the memory it will be cached in.
+	 * Construct receives uninitialized memory sized and aligned for Struct and must construct a Struct
+	 * there. It is called exactly once if this succeeds and never if it fails, and may run under the
+	 * shard lock, so it must not touch this collection.
+	 * @param KeyHash Must be FHippocacheKey::HashString(Key).
+	 */
+	FHippocacheResult Emplace(const FString& Key, uint64 KeyHash, const UScriptStruct* Struct, TFunctionRef<void(void* Memory)> Construct, FTimespan TTL);
+
+	/**
+	 * @brief Copies the value stored under Key into OutValue. Lock-free for FlatTable collections.
+	 * @param KeyHash Must be FHippocacheKey::HashString(Key).
+	 */
+	FHippocacheResult Get(const FString& Key, uint64 KeyHash, FInstancedStruct& OutValue) const;
+	FHippocacheResult Get(const FHippocacheKey& Key, FInstancedStruct& OutValue) const { return Get(Key.GetKey(), Key.GetHash(), OutValue); }
+	FHippocacheResult Get(const FString& Key, FInstancedStruct& OutValue) const { return Get(Key, FHippocacheKey::HashString(Key), OutValue); }
+
+	/**
+	 * @brief Copies the value stored under Key into OutMemory, which must hold an initialized Struct.
+	 * Fails with TypeMismatch if the stored value is of another type.
+	 * @param KeyHash Must be FHippocacheKey::HashString(Key).
+	 */
+	FHippocacheResult Get(const FString& Key, uint64 KeyHash, const UScriptStruct* Struct, void* OutMemory) const;
+
+	/**
+	 * @brief Calls Visitor with the type and memory of the value stored under Key, without copying it.
+	 * The value stays alive, unchanged, until Visitor returns, even if the key is overwritten or removed
+	 * meanwhile. Visitor runs under the shard read lock or an epoch read scope, so it must not write to
+	 * this collection.
+	 * @param KeyHash Must be FHippocacheKey::HashString(Key).
+	 */
+	FHippocacheResult Read(const FString& Key, uint64 KeyHash, TFunctionRef<void(const UScriptStruct* Struct, const void* Memory)> Visitor) const;
+
+	/**
+	 * @brief Calls Mutator with the value stored under Key so it can modify it where it is stored.
+	 * Mutator runs under the shard write lock, so updates of one key never interleave, and the item keeps
+	 * its deadline. Readers never see a half-applied update: inline values in flat tables are
+	 * rewritten under their Sequence, and a heap value in a flat table is mutated in a copy that then
+	 * replaces the entry, since lock-free readers may still be reading the original. Mutator must not
+	 * access this collection.
+	 * @param ExpectedStruct If set, fails with TypeMismatch, without calling Mutator, for any other type.
+	 * @param KeyHash Must be FHippocacheKey::HashString(Key).
+	 */
+	FHippocacheResult Update(const FString& Key, uint64 KeyHash, const UScriptStruct* ExpectedStruct, TFunctionRef<void(const UScriptStruct* Struct, void* Memory)> Mutator);
+
+	/**
+	 * @brief Applies Op to the small Struct value stored under Key, atomically with respect to every other write of Key.
+	 * Meant for counters and other values that a few instructions update. In a FlatTable collection a live
+	 * inline value is modified inside its entry's Sequence write section alone, without the shard lock, so
+	 * updates of different keys never wait for each other and lock-free readers only retry for the duration
+	 * of Op. Other collections and the create path take the shard write lock.
+	 * Op receives the stored value with bFound true, or a default-constructed Struct with bFound false when
+	 * Key has no live item; in that case it returns whether the value it built should be stored, with no TTL.
+	 * Op must not access this collection.
+	 * @param Struct Must be storable inline (see FCachedItem::CanStoreInline).
+	 * @param KeyHash Must be FHippocacheKey::HashString(Key).
+	 * @return TypeMismatch if Key holds a live value of another type, or ItemNotFound (ItemExpired) if Op declined to create it.
+	 */
+	FHippocacheResult UpdateInline(const FString& Key, uint64 KeyHash, const UScriptStruct* Struct, TFunctionRef<bool(void* Memory, bool bFound)> Op);
+
+	/**
+	 * @brief Removes the item stored under Key.
+	 * @param KeyHash Must be FHippocacheKey::HashString(Key).
+	 */
+	FHippocacheResult Remove(const FString& Key, uint64 KeyHash);
+	FHippocacheResult Remove(const FHippocacheKey& Key) { return Remove(Key.GetKey(), Key.GetHash()); }
+	FHippocacheResult Remove(const FString& Key) { return Remove(Key, FHippocacheKey::HashString(Key)); }
+
+	/**
+	 * @brief Removes every item from the collection.
+	 * Slab-backed collections release each shard's slab pages in one step instead of freeing item by item.
+	 * @return The number of items removed.
+	 */
+	int32 Clear();
+
+	/** Gets the number of items currently stored, including expired items not yet cleaned up. */
+	int32 Num() const;
+
+	/**
+	 * @brief Removes all expired items.
+	 * @return The number of items removed.
+	 */
+	int32 RemoveExpired();
+
+	/**
+	 * @brief Removes the items whose expiry is due, a slice at a time, continuing where the previous call stopped.
+	 * Every write with a TTL schedules the item in its shard's timing wheel, so the sweep only looks at
+	 * items that are due, never at the rest. Shards are swept in order, each under its write lock for at
+	 * most Budget.MaxLockSeconds before the lock is released and retaken, so readers and writers get in
+	 * between slices. Items readers have queued as expired are removed whenever a shard is locked, outside
+	 * the budget. Stops once Budget runs out of records or time. Calls must not overlap; the owning
+	 * subsystem's sweep serializes them.
+	 * @return True if this call emptied every shard's due records; the next one starts from the first shard.
+	 */
+	bool SweepExpired(FHippocacheSweepBudget& Budget, FHippocacheSweepStats& Stats);
+
+	/**
+	 * @brief Calls Visitor with every unexpired item, one shard at a time.
+	 * Typed collections walk each shard's dense value array in order. Visitor runs under the shard
+	 * read lock (or an epoch read scope for FlatTable), so it must not write to this collection.
+	 */
+	void ForEach(TFunctionRef<void(const FString& Key, const UScriptStruct* Struct, const void* Memory)> Visitor) const;
+
+private:
+	/**
+	 * Swiss-style slot array. Slots are split into 16-wide groups probed triangularly; each slot
+	 * has a control byte (empty, deleted, or 7 bits of hash) and an entry pointer. Replaced
+	 * wholesale when it grows.
+	 */
+	struct FTable
+	{
+		explicit FTable(int32 InCapacity);
+		~FTable();
+
+		FTable(const FTable&) = delete;
+		FTable& operator=(const FTable&) = delete;
+
+		/** Number of slots. A power of two, and at least one group. */
+		int32 Capacity;
+
+		/** One control byte per slot, 16-byte aligned so a group loads with one instruction. */
+		uint8* Controls;
+
+		/** Entry pointers. nullptr for empty and deleted slots. */
+		TUniquePtr<std::atomic<FHippocacheEntry*>[]> Slots;
+	};
+
+	/**
+	 * Dense storage for one shard of a typed collection. Values of ValueType sit back to back in
+	 * Values, with keys and expiration data in parallel arrays, and Index maps each key to its
+	 * position. Removing an item moves the last one into its place, so the arrays stay dense.
+	 */
+	struct FTypedStore
+	{
+		/** Key to position in the arrays below. */
+		TMap<FString, int32> Index;
+
+		TArray<FString> Keys;
+		TArray<uint64> Deadlines;
+
+		/** Deadline of each item's expiry record, like FHippocacheEntry::ScheduledDeadline. */
+		TArray<uint64> ScheduledDeadlines;
+
+		/** Keys.Num() initialized values, ValueStride bytes apart, in room for Capacity. */
+		uint8* Values = nullptr;
+		int32 Capacity = 0;
+	};
+
+	/** A node of a shard's ExpiredQueue. */
+	struct FExpiredNotice;
+
+	/** One independently locked slice of the collection. */
+	struct alignas(PLATFORM_CACHE_LINE_SIZE) FShard
+	{
+		/** Serializes writers. FlatTable readers never take it; TMap readers take it shared. */
+		mutable FRWLock Lock;
+
+		/** FlatTable index. Loaded by readers under an epoch read scope. */
+		std::atomic<FTable*> Table { nullptr };
+
+		/** TMap index. Guarded by Lock. Owns its entries. */
+		TMap<FString, FHippocacheEntry*> Index;
+
+		/** Live entries. Guarded by Lock. */
+		int32 NumItems = 0;
+
+		/** FlatTable slots marked deleted since the last rebuild. Guarded by Lock. */
+		int32 NumDeleted = 0;
+
+		/** Entry allocator in Slab mode, replaced on Clear. Guarded by Lock. */
+		FHippocacheSlabAllocator* Slab = nullptr;
+
+		/** Typed collection storage, used instead of the index and entries. Guarded by Lock. */
+		FTypedStore Typed;
+
+		/** Expiry schedule of the items written with a TTL, created by the first one. Guarded by Lock. */
+		TUniquePtr<FHippocacheTimingWheel> ExpiryWheel;
+
+		/** Expired items readers came across, pushed without the lock and removed by the next writer. */
+		mutable std::atomic<FExpiredNotice*> ExpiredQueue { nullptr };
+		mutable std::atomic<int32> NumExpiredQueued { 0 };
+	};
+
+	/** A shard's storage detached by Clear, destroyed as one unit once readers leave. */
+	struct FDetachedStorage
+	{
+		FTable* Table = nullptr;
+		FHippocacheSlabAllocator* Slab = nullptr;
+	};
+
+	/** Selects the shard that owns Hash. */
+	FShard& GetShard(uint64 Hash) const;
+
+	/**
+	 * Finds the live item for Key and passes its type and memory to Reader, while the entry is pinned.
+	 * Inline values in flat tables are first copied to a consistent local snapshot.
+	 */
+	FHippocacheResult ReadValue(const FString& Key, uint64 Hash, TFunctionRef<FHippocacheResult(const UScriptStruct*, const void*)> Reader) const;
+
+	/**
+	 * Copies a FlatTable entry's inline value and expiration data out under its Sequence, so the copy
+	 * is consistent even if a writer rewrites the value meanwhile.
+	 */
+	static void SnapshotInlineItem(const FHippocacheEntry& Entry, const UScriptStruct*& OutStruct, uint64& OutDeadline, uint8* OutData);
+
+	/**
+	 * Runs Write, which rewrites a published FlatTable entry's inline item, inside a Sequence write section.
+	 * Holders of the shard write lock and UpdateInline, which doesn't take it, claim the section in turn.
+	 */
+	static void WriteInlineItem(FHippocacheEntry& Entry, TFunctionRef<void()> Write);
+
+	/** Gets the value at Position in a typed store. */
+	uint8* GetTypedValue(const FTypedStore& Store, int32 Position) const { return Store.Values + static_cast<SIZE_T>(Position) * ValueStride; }
+
+	/** Appends a value built by Construct to a typed store. Requires the shard write lock. */
+	void AddTypedItem(FTypedStore& Store, const FString& Key, TFunctionRef<void(void* Memory)> Construct, uint64 Deadline) const;
+
+	/** Removes the item at Position from a typed store, moving the last item into its place. Requires the shard write lock. */
+	void RemoveTypedItem(FTypedStore& Store, int32 Position) const;
+
+	/** Destroys every value in a typed store and releases its memory. */
+	void ResetTypedStore(FTypedStore& Store) const;
+
+	/** Finds the entry for Key in Table. Safe without the shard lock inside an epoch read scope. */
+	static FHippocacheEntry* FindEntry(const FTable& Table, const FString& Key, uint64 Hash, int32* OutSlotIndex = nullptr);
+
+	/**
+	 * Finds Entry in Table, for callers that kept its address and hash rather than its key. The address is only
+	 * compared, so it may be stale. Requires the shard write lock.
+	 */
+	static FHippocacheEntry* FindEntryByAddress(const FTable& Table, uint64 Hash, const FHippocacheEntry* Entry, int32* OutSlotIndex);
+
+	/** Finds the first empty or deleted slot on Hash's probe sequence. Requires the shard write lock. */
+	static int32 FindInsertSlot(const FTable& Table, uint64 Hash);
+
+	/** Fills a slot. Publishes the entry pointer before the control byte. */
+	static void StoreSlot(FTable& Table, int32 SlotIndex, FHippocacheEntry* Entry, uint64 Hash);
+
+	/** Marks a slot deleted. */
+	static void ClearSlot(FTable& Table, int32 SlotIndex);
+
+	/** Rebuilds Shard's table if inserting one more entry would overfill it. Requires the shard write lock. */
+	static void ReserveForInsert(FShard& Shard);
+
+	/**
+	 * Shared body of Set and Emplace. New entries take over AdoptedValue when it is set (Struct is then
+	 * never inline), and are built with Construct otherwise.
+	 */
+	FHippocacheResult StoreValue(const FString& Key, uint64 Hash, const UScriptStruct* Struct, TFunctionRef<void(void* Memory)> Construct, FInstancedStruct* AdoptedValue, FTimespan TTL);
+
+	/**
+	 * The part of StoreValue that runs under the shard write lock. Struct must already be checked against
+	 * ValueType. NewEntry, if set, is a heap entry built ahead of the lock for a FlatTable collection.
+	 */
+	void StoreValueLocked(FShard& Shard, const FString& Key, uint64 Hash, const UScriptStruct* Struct, TFunctionRef<void(void* Memory)> Construct, FInstancedStruct* AdoptedValue, FTimespan TTL, FHippocacheEntry* NewEntry);
+
+	/**
+	 * Schedules the expiry of the item just written under Key in Shard's timing wheel, if it has a Deadline
+	 * and its ScheduledDeadline record doesn't already come due first; that record is re-armed for the
+	 * later deadline when it pops (see RemoveDueItem). Entry is the item's entry, or nullptr in a typed
+	 * collection. Requires the shard write lock.
+	 */
+	void ScheduleExpiry(FShard& Shard, const FString& Key, uint64 Hash, uint64 Deadline, const FHippocacheEntry* Entry, uint64& ScheduledDeadline) const;
+
+	/**
+	 * Removes the item a due expiry record or expired notice names, if it has expired at Now. If it was
+	 * written again with a later deadline and Record is its scheduled record, Record is moved back into
+	 * the wheel for that deadline. Requires the shard write lock.
+	 * @return Whether an item was removed.
+	 */
+	bool RemoveDueItem(FShard& Shard, FHippocacheExpiryRecord& Record, uint64 Now);
+
+	/**
+	 * Queues the removal of an expired item a reader found, for the next writer of Shard. Needs no lock,
+	 * so readers never upgrade theirs. Entry is the item's entry, or nullptr in a typed collection.
+	 */
+	void QueueExpired(const FShard& Shard, const FString& Key, uint64 Hash, uint64 Deadline, const FHippocacheEntry* Entry) const;
+
+	/**
+	 * Removes the expired items readers have queued for Shard. Requires the shard write lock.
+	 * @return The number of items removed.
+	 */
+	int32 RemoveQueuedExpired(FShard& Shard);
+
+	/** Frees the notices readers have queued for Shard without acting on them, when its items are going anyway. */
+	static void DiscardQueuedExpired(FShard& Shard);
+
+	/**
+	 * Creates an entry with the collection's allocator. The entry and its value, when it isn't inline
+	 * or adopted, share one allocation. In Slab mode that is a block from Shard's slab, so this requires
+	 * the shard write lock; pairs too large for a block fall back to the heap.
+	 */
+	FHippocacheEntry* CreateEntry(FShard& Shard, const FString& Key, uint64 Hash, const UScriptStruct* Struct, TFunctionRef<void(void* Memory)> Construct, FInstancedStruct* AdoptedValue, FTimespan TTL) const;
+
+	/** Destroys an unreachable entry now, whichever allocator it came from. */
+	static void DestroyEntry(void* Entry);
+
+	/** Destroys an entry whose memory belongs to a slab that is about to be released as a whole. */
+	static void DestroyEntryInPlace(FHippocacheEntry* Entry);
+
+	/**
+	 * Retires an unlinked entry. Call under the shard write lock: Retire runs deleters in order,
+	 * so this keeps every slab entry ahead of the slab itself when Clear retires it.
+	 */
+	static void RetireEntry(FHippocacheEntry* Entry);
+
+	/** Epoch deleters for tables that do or don't still own their entries. */
+	static void DeleteTable(void* Table);
+	static void DeleteTableAndEntries(void* Table);
+
+	/** Epoch deleter for FDetachedStorage. */
+	static void DeleteDetachedStorage(void* Storage);
+
+	/** Collection name. */
+	FName Name;
+
+	/** Index structure backing the shards. */
+	EHippocacheIndexType IndexType;
+
+	/** Allocator for entries and value payloads. */
+	EHippocacheValueAllocator ValueAllocator;
+
+	/** Struct type of a typed collection, or nullptr. */
+	const UScriptStruct* ValueType;
+
+	/** Bytes between consecutive values in a typed store. */
+	int32 ValueStride = 0;
+
+	/** Lock shards, allocated once at construction. */
+	TArray<TUniquePtr<FShard>> Shards;
+
+	/** Mask applied to the key hash to select a shard. */
+	uint32 ShardMask;
+
+	/** Set once the collection is removed from its subsystem. */
+	std::atomic<bool> bDestroyed { false };
+
+	/** Shard SweepExpired resumes at. */
+	int32 SweepShard = 0;
+};
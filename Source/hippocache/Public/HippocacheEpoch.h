@@ -0,0 +1,64 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * @brief Process-wide epoch-based memory reclamation for Hippocache's lock-free read paths.
+ *
+ * Readers enter an FReadScope before loading any shared pointer and leave it when done.
+ * Writers unlink an object first and then hand it to Retire(); the object is destroyed only
+ * after every reader that could still have seen it has left its scope. Retired objects are
+ * destroyed in the order they were retired, even when several threads reclaim at once, so an
+ * object may rely on everything retired before it being gone (see FHippocacheCollection's slabs).
+ *
+ * Read scopes are cheap (one thread-local check and one store to a per-thread slot), may be
+ * nested, and must not be held across long-running work since they delay reclamation.
+ */
+class HIPPOCACHE_API FHippocacheEpoch
+{
+public:
+	/** Destroys a retired object. */
+	using FDeleter = void (*)(void* Object);
+
+	/** Pins the current epoch for the calling thread while in scope. */
+	class HIPPOCACHE_API FReadScope
+	{
+	public:
+		FReadScope();
+		~FReadScope();
+
+		FReadScope(const FReadScope&) = delete;
+		FReadScope& operator=(const FReadScope&) = delete;
+	};
+
+	/**
+	 * @brief Schedules an unlinked object for destruction once no reader can still see it.
+	 * @param Object The object to destroy. Must already be unreachable for new readers.
+	 * @param Deleter Function that destroys Object.
+	 */
+	static void Retire(void* Object, FDeleter Deleter);
+
+	/** Schedules an unlinked object allocated with new for deletion. */
+	template<typename T>
+	static void Retire(T* Object)
+	{
+		if (Object)
+		{
+			Retire(Object, [](void* Ptr) { delete static_cast<T*>(Ptr); });
+		}
+	}
+
+	/**
+	 * @brief Destroys every retired object that no active reader can still reference.
+	 * Waits for a batch another thread is destroying, so batches never interleave. Called from a deleter,
+	 * it does nothing: objects the deleter retires are left to a later call.
+	 * @return The number of objects destroyed.
+	 */
+	static int32 Reclaim();
+
+	/** Gets the number of retired objects still waiting for readers to leave. */
+	static int32 NumPendingRetired();
+
+	/** Destroys all retired objects immediately. Only call when no reader can be active (module shutdown). */
+	static void Shutdown();
+};
@@ -0,0 +1,50 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/Runnable.h"
+#include <atomic>
+
+class FRunnableThread;
+class FEvent;
+
+/**
+ * @brief A dedicated thread that runs the expiration sweep at a fixed interval.
+ *
+ * Lets a subsystem sweep without a world timer (commandlets, game instances without a world) and keeps
+ * the sweep off the game thread. The step it runs must be safe to call from this thread; the subsystem's
+ * sweep is, since it only takes shard locks and epoch read scopes. Destroying the worker stops the
+ * thread and waits for a running step to finish.
+ */
+class HIPPOCACHE_API FHippocacheExpiryWorker : public FRunnable
+{
+public:
+	/**
+	 * @brief Starts the thread.
+	 * @param InStep Work to do every interval.
+	 * @param InIntervalSeconds Seconds between the end of one step and the start of the next.
+	 */
+	FHippocacheExpiryWorker(TFunction<void()> InStep, float InIntervalSeconds);
+	virtual ~FHippocacheExpiryWorker() override;
+
+	FHippocacheExpiryWorker(const FHippocacheExpiryWorker&) = delete;
+	FHippocacheExpiryWorker& operator=(const FHippocacheExpiryWorker&) = delete;
+
+	// FRunnable implementation
+	virtual uint32 Run() override;
+	virtual void Stop() override;
+
+private:
+	/** The sweep step. */
+	TFunction<void()> Step;
+
+	/** Milliseconds between steps. */
+	uint32 IntervalMs;
+
+	/** Set by Stop; the thread exits at its next wakeup. */
+	std::atomic<bool> bStopping { false };
+
+	/** Waited on between steps, and triggered by Stop so the thread doesn't sleep out the interval. */
+	FEvent* WakeEvent = nullptr;
+
+	FRunnableThread* Thread = nullptr;
+};
@@ -0,0 +1,70 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HippocacheKey.generated.h"
+
+/**
+ * @brief A cache key with its hash computed once up front.
+ *
+ * Every string-keyed call hashes the key before it can probe a collection. Code that looks up
+ * the same keys every frame can build an FHippocacheKey once (or with Make Hippocache Key in
+ * Blueprint) and pass it to the FHippocacheKey overloads instead, skipping that work.
+ * Keys compare case-insensitively, so "Score" and "score" produce the same hash.
+ */
+USTRUCT(BlueprintType)
+struct HIPPOCACHE_API FHippocacheKey
+{
+	GENERATED_BODY()
+
+	FHippocacheKey() = default;
+
+	explicit FHippocacheKey(const FString& InKey)
+		: Key(InKey)
+		, Hash(HashString(Key))
+	{}
+
+	explicit FHippocacheKey(FString&& InKey)
+		: Key(MoveTemp(InKey))
+		, Hash(HashString(Key))
+	{}
+
+	explicit FHippocacheKey(const TCHAR* InKey)
+		: Key(InKey)
+		, Hash(HashString(Key))
+	{}
+
+	/** Gets the key string. */
+	const FString& GetKey() const { return Key; }
+
+	/** Gets the precomputed hash. */
+	uint64 GetHash() const { return Hash; }
+
+	/** Whether the key is non-empty. */
+	bool IsValid() const { return !Key.IsEmpty(); }
+
+	/** Gets the key characters, like FString's operator*, so keys format the same way in messages. */
+	const TCHAR* operator*() const { return *Key; }
+
+	/** Case-insensitive 64-bit hash used by every collection for shard selection and probing. */
+	static uint64 HashString(const FString& InKey);
+
+	/** Recomputes the hash after Key is loaded, since only Key is serialized. */
+	void PostSerialize(const FArchive& Ar);
+
+private:
+	/** The key as supplied. */
+	UPROPERTY()
+	FString Key;
+
+	/** HashString(Key). Not a UPROPERTY: always derived from Key, and copied with it. */
+	uint64 Hash = 0;
+};
+
+template<>
+struct TStructOpsTypeTraits<FHippocacheKey> : public TStructOpsTypeTraitsBase2<FHippocacheKey>
+{
+	enum
+	{
+		WithPostSerialize = true,
+	};
+};
@@ -0,0 +1,67 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/UnrealType.h"
+#include "HippocachePropertyValue.generated.h"
+
+class FHippocachePropertyType;
+
+/**
+ * @brief A value of any Blueprint property type that has no struct of its own - arrays, maps, sets,
+ * enums and soft references - so the wildcard nodes can cache it without boxing it in a custom struct.
+ *
+ * The value lives in a buffer laid out exactly like the property, and the property itself copies,
+ * compares and destroys it (CopyCompleteValue, SameType, DestroyValue). There is no serialization step.
+ *
+ * The value owns a duplicate of the property it was built from, shared by its copies, and keeps the
+ * structs and enums that duplicate refers to alive. Cached values therefore survive the source property
+ * going away in a Blueprint recompile, hot reload or GC; after one they just stop matching the new
+ * property. Values that hold object references are rejected, because the cache does not report
+ * references to the GC.
+ */
+USTRUCT()
+struct HIPPOCACHE_API FHippocachePropertyValue
+{
+	GENERATED_BODY()
+
+	FHippocachePropertyValue() = default;
+
+	/** Copies the value of Property found at Source. */
+	FHippocachePropertyValue(const FProperty* InProperty, const void* Source);
+
+	FHippocachePropertyValue(const FHippocachePropertyValue& Other);
+	FHippocachePropertyValue(FHippocachePropertyValue&& Other);
+	FHippocachePropertyValue& operator=(const FHippocachePropertyValue& Other);
+	FHippocachePropertyValue& operator=(FHippocachePropertyValue&& Other);
+	~FHippocachePropertyValue();
+
+	/** True if values of OtherProperty can be copied to and from this value. */
+	bool IsSameType(const FProperty* OtherProperty) const;
+
+	/** Copies the value over the initialized OtherProperty value at Destination. Requires IsSameType. */
+	void CopyTo(const FProperty* OtherProperty, void* Destination) const;
+
+	/** Gets the value's own copy of its property, or null if the value is empty. */
+	const FProperty* GetProperty() const;
+
+	bool operator==(const FHippocachePropertyValue& Other) const;
+
+private:
+	/** Large enough for every container, enum and soft reference property, so only odd types hit the heap. */
+	static constexpr int32 InlineSize = 80;
+
+	void Allocate();
+	void Reset();
+	void MoveFrom(FHippocachePropertyValue& Other);
+
+	bool IsInline() const
+	{
+		return Memory == &InlineValue;
+	}
+
+	TSharedPtr<FHippocachePropertyType, ESPMode::ThreadSafe> Type;
+
+	/** The value: InlineValue, or a heap block when it doesn't fit. */
+	void* Memory = nullptr;
+	TAlignedBytes<InlineSize, 16> InlineValue;
+};
@@ -31,8 +31,11 @@ enum class EHippocacheErrorCode : uint8
 
 /**
  * @brief Result structure for Hippocache operations with error context.
+ *
+ * Blueprint breaks the result through UHippocacheBlueprintLibrary::BreakHippocacheResult, which goes through
+ * the accessors, so lazily described errors read the same there as eager ones.
  */
-USTRUCT(BlueprintType)
+USTRUCT(BlueprintType, meta = (HasNativeBreak = "/Script/Hippocache.HippocacheBlueprintLibrary.BreakHippocacheResult"))
 struct HIPPOCACHE_API FHippocacheResult
 {
 	GENERATED_BODY()
@@ -41,11 +44,11 @@ struct HIPPOCACHE_API FHippocacheResult
 	UPROPERTY(BlueprintReadOnly, Category = "Hippocache")
 	EHippocacheErrorCode ErrorCode;
 
-	/** Human-readable error message */
+	/** Human-readable error message. Empty for lazily described errors; GetErrorMessage() always has it. */
 	UPROPERTY(BlueprintReadOnly, Category = "Hippocache")
 	FString ErrorMessage;
 
-	/** Additional context information */
+	/** Additional context information. Empty for lazily described errors; GetErrorContext() always has it. */
 	UPROPERTY(BlueprintReadOnly, Category = "Hippocache")
 	FString ErrorContext;
 
@@ -73,6 +76,64 @@ struct HIPPOCACHE_API FHippocacheResult
 		return FHippocacheResult(InErrorCode, InErrorMessage, InErrorContext);
 	}
 
+	/**
+	 * @brief Creates an error result that is only described when someone asks for the description.
+	 *
+	 * Cache misses are ordinary control flow, so they must not format strings nobody reads. The message
+	 * must be a string literal; GetErrorContext() formats "Collection: <Collection>, Key: <Key>" from the
+	 * stored name and key, or just the collection when Key is empty. The first InlineKeyLength characters
+	 * of the key are copied into the result, so creating one never allocates; a longer key is shown
+	 * truncated, followed by InKeyHash.
+	 */
+	static FHippocacheResult Lazy(EHippocacheErrorCode InErrorCode, const TCHAR* InStaticMessage, FName InCollection, const FString& InKey = FString(), uint64 InKeyHash = 0)
+	{
+		FHippocacheResult Result(InErrorCode);
+		Result.StaticMessage = InStaticMessage;
+		Result.ContextCollection = InCollection;
+		Result.ContextKeyLength = InKey.Len();
+		Result.ContextKeyHash = InKeyHash;
+		FMemory::Memcpy(Result.ContextKey, *InKey, FMath::Min(Result.ContextKeyLength, InlineKeyLength) * sizeof(TCHAR));
+		return Result;
+	}
+
+	/** Gets the error message, formatting it if the result was created lazily */
+	FString GetErrorMessage() const
+	{
+		return StaticMessage ? FString(StaticMessage) : ErrorMessage;
+	}
+
+	/** Gets the error context, formatting it if the result was created lazily */
+	FString GetErrorContext() const
+	{
+		if (!StaticMessage)
+		{
+			return ErrorContext;
+		}
+		if (ContextKeyLength == 0)
+		{
+			return FString::Printf(TEXT("Collection: %s"), *ContextCollection.ToString());
+		}
+		if (ContextKeyLength <= InlineKeyLength)
+		{
+			return FString::Printf(TEXT("Collection: %s, Key: %s"), *ContextCollection.ToString(), *FString(ContextKeyLength, ContextKey));
+		}
+		return FString::Printf(TEXT("Collection: %s, Key: %s... (hash %016llx)"), *ContextCollection.ToString(), *FString(InlineKeyLength, ContextKey), ContextKeyHash);
+	}
+
+	/**
+	 * Fills in ErrorMessage and ErrorContext of a lazily created result. Only needed where the result is
+	 * handed to something that reads the properties by reflection instead of through the accessors.
+	 */
+	void Describe()
+	{
+		if (StaticMessage)
+		{
+			ErrorMessage = StaticMessage;
+			ErrorContext = GetErrorContext();
+			StaticMessage = nullptr;
+		}
+	}
+
 	/** Checks if the operation was successful */
 	bool IsSuccess() const { return ErrorCode == EHippocacheErrorCode::None; }
 
@@ -87,6 +148,19 @@ struct HIPPOCACHE_API FHippocacheResult
 
 	/** Bool conversion operator for convenient if checks */
 	explicit operator bool() const { return IsSuccess(); }
+
+	/** Key length a lazy result stores in full */
+	static constexpr int32 InlineKeyLength = 32;
+
+private:
+	/** Lazy description: a literal message plus the collection and key it is about */
+	const TCHAR* StaticMessage = nullptr;
+	FName ContextCollection;
+	int32 ContextKeyLength = 0;
+	uint64 ContextKeyHash = 0;
+
+	/** The first min(ContextKeyLength, InlineKeyLength) characters of the key; the rest is unset */
+	TCHAR ContextKey[InlineKeyLength];
 };
 
 /**
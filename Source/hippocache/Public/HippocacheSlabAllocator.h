@@ -0,0 +1,91 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/CriticalSection.h"
+
+/**
+ * @brief Size-class slab allocator for a collection shard's entries and value payloads.
+ *
+ * Blocks are carved out of PageSize pages, and every page holds blocks of a single size class,
+ * so entries of the same struct type end up packed next to each other instead of scattered over
+ * the global heap. Freed blocks go to a per-class free list and are reused before new pages are
+ * taken. Destroying the allocator releases every page at once without visiting the blocks, which
+ * is what makes clearing a slab-backed collection cheap.
+ *
+ * Allocate and Free are thread-safe. Blocks must be destroyed by their users before the allocator
+ * goes away; the allocator never runs destructors.
+ */
+class HIPPOCACHE_API FHippocacheSlabAllocator
+{
+public:
+	/** Size, and alignment, of each page. */
+	static constexpr int32 PageSize = 64 * 1024;
+
+	/** Block sizes are multiples of this, which is also every block's alignment. */
+	static constexpr int32 BlockAlignment = 16;
+
+	/** Largest block served from pages. Callers fall back to the global heap above it. */
+	static constexpr int32 MaxBlockSize = 1024;
+
+	FHippocacheSlabAllocator() = default;
+	~FHippocacheSlabAllocator();
+
+	FHippocacheSlabAllocator(const FHippocacheSlabAllocator&) = delete;
+	FHippocacheSlabAllocator& operator=(const FHippocacheSlabAllocator&) = delete;
+
+	/**
+	 * @brief Allocates an uninitialized block.
+	 * @param Size Bytes needed, at most MaxBlockSize.
+	 * @return A BlockAlignment-aligned block.
+	 */
+	void* Allocate(int32 Size);
+
+	/** Returns a block from Allocate to the allocator that owns it. */
+	static void Free(void* Block);
+
+	/** Gets the number of pages currently held. */
+	int32 NumPages() const;
+
+	/** Gets the number of blocks currently handed out. */
+	int32 NumAllocatedBlocks() const;
+
+private:
+	/** Header at the start of every page. Blocks follow it. */
+	struct FPageHeader
+	{
+		FHippocacheSlabAllocator* Owner;
+		int32 SizeClass;
+	};
+
+	/** A freed block, linked into its size class's free list. */
+	struct FFreeBlock
+	{
+		FFreeBlock* Next;
+	};
+
+	/** Blocks of one size. */
+	struct FSizeClass
+	{
+		/** Freed blocks, reused first. */
+		FFreeBlock* FreeList = nullptr;
+
+		/** Unused tail of the newest page for this class. */
+		uint8* Cursor = nullptr;
+		uint8* End = nullptr;
+	};
+
+	static constexpr int32 NumSizeClasses = MaxBlockSize / BlockAlignment;
+
+	/** Bytes reserved for the page header, keeping the first block aligned. */
+	static constexpr int32 HeaderSize = (sizeof(FPageHeader) + BlockAlignment - 1) / BlockAlignment * BlockAlignment;
+
+	/** Guards everything below. */
+	mutable FCriticalSection Lock;
+
+	FSizeClass SizeClasses[NumSizeClasses];
+
+	/** Every page, for release on destruction. */
+	TArray<void*> Pages;
+
+	int32 AllocatedBlocks = 0;
+};
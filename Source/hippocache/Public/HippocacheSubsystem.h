@@ -4,80 +4,25 @@
 #include "Subsystems/GameInstanceSubsystem.h"
 #include "HAL/CriticalSection.h"
 #include "Runtime/Launch/Resources/Version.h"
+#include <atomic>
 
 // Version-specific includes for StructUtils
 #if ENGINE_MAJOR_VERSION >= 5 && ENGINE_MINOR_VERSION >= 4
 #include "StructUtils/InstancedStruct.h"
+#include "StructUtils/StructView.h"
 #else
 #include "InstancedStruct.h"
+#include "StructView.h"
 #endif
 
 #include "HippocacheResult.h"
+#include "HippocacheCollection.h"
+#include "HippocacheKey.h"
 #include "HippocacheVariantWrapper.h"
+#include "HippocacheWrapperStructs.h"
 #include "HippocacheSubsystem.generated.h"
 
-/**
- * @brief Represents a single cached item using unified FInstancedStruct storage.
- * All data types (primitives and structs) are stored as FInstancedStruct for consistency.
- */
-USTRUCT()
-struct FCachedItem
-{
-	GENERATED_BODY()
-
-	/** The cached data stored as FInstancedStruct (unified storage for all types). */
-	UPROPERTY()
-	FInstancedStruct Value;
-
-	/** Time to live in seconds. 0.0f means no expiration. */
-	UPROPERTY()
-	FTimespan TTL;
-
-	/** Timestamp when this item was cached. */
-	UPROPERTY()
-	double CreationTime;
-
-	// TODO: Memory features - disabled for now, implement later
-	/** Last access time for LRU eviction */
-	mutable double LastAccessTime;
-
-	/** Estimated memory size in bytes */
-	// int64 EstimatedSizeBytes;
-
-	/** Default constructor. */
-	FCachedItem()
-		: TTL(FTimespan::Zero())
-		, CreationTime(0.0)
-		, LastAccessTime(0.0)
-		// , EstimatedSizeBytes(0)
-	{}
-
-	/** Constructor for any type stored as FInstancedStruct. */
-	FCachedItem(const FInstancedStruct& InValue, FTimespan InTTL)
-		: Value(InValue)
-		, TTL(InTTL)
-		, CreationTime(FPlatformTime::Seconds())
-		, LastAccessTime(FPlatformTime::Seconds())
-	{}
-
-	/** Checks if the item has expired. */
-	bool HasExpired() const
-	{
-		return TTL > FTimespan::Zero() && (FPlatformTime::Seconds() - CreationTime) > TTL.GetTotalSeconds();
-	}
-
-	/** Updates last access time */
-	void UpdateAccessTime() const
-	{
-		LastAccessTime = FPlatformTime::Seconds();
-	}
-
-	/** Get time since last access */
-	double GetTimeSinceLastAccess() const
-	{
-		return FPlatformTime::Seconds() - LastAccessTime;
-	}
-};
+class FHippocacheExpiryWorker;
 
 // TODO: Memory limit features - disabled for now, implement later
 
@@ -144,14 +89,64 @@ struct HIPPOCACHE_API FHippocacheMemoryStats
 };
 */
 
+/**
+ * @brief Immutable snapshot of the collection directory.
+ * Lookups read the current snapshot without locking; creating a collection publishes a new snapshot.
+ */
+struct FHippocacheCollectionDirectory
+{
+	TMap<FName, TSharedPtr<FHippocacheCollection, ESPMode::ThreadSafe>> Collections;
+};
+
+/**
+ * @brief A collection resolved once, via UHippocacheSubsystem::CreateOrGetCollection.
+ * Handle overloads go straight to the collection's shards, skipping the directory lookup that
+ * name-based calls pay every time. The handle keeps the collection's memory alive, but once the
+ * collection is removed (RemoveCollection, or the subsystem shutting down) every call through it
+ * fails with InvalidCollection.
+ */
+struct HIPPOCACHE_API FHippocacheCollectionHandle
+{
+	/** Whether the handle points at a collection that has not been removed. */
+	bool IsValid() const { return CollectionPtr.IsValid() && !CollectionPtr->IsDestroyed(); }
+
+	/** Gets the collection name, or None for an empty handle. */
+	FName GetName() const { return CollectionPtr.IsValid() ? CollectionPtr->GetName() : NAME_None; }
+
+	/** Drops the reference to the collection. */
+	void Reset() { CollectionPtr.Reset(); }
+
+private:
+	friend class UHippocacheSubsystem;
+
+	TSharedPtr<FHippocacheCollection, ESPMode::ThreadSafe> CollectionPtr;
+};
+
+/** Restricts a forwarding-reference overload to non-const rvalues, which it may move from. */
+template<typename T>
+using THippocacheMovableValue = std::enable_if_t<!std::is_reference_v<T> && !std::is_const_v<T>>;
+
 // Client-side cache interface has been disabled for now as it's not being used
 // All functionality is available through UHippocacheBlueprintLibrary instead
 
 /**
  * @brief Manages and provides access to named FHippocacheClient instances.
  * This is the central point for creating and retrieving cache client in Blueprints and C++.
+ *
+ * Every collection owns its own storage and ShardCount power-of-two lock shards, so
+ * collections never contend with each other. Expired items are removed by an incremental sweep
+ * that runs every ExpirySweepInterval seconds within a small item and time budget, on the world's timer or,
+ * with bExpiryWorkerThread, on a dedicated thread. Configure it in DefaultGame.ini:
+ *   [/Script/Hippocache.HippocacheSubsystem]
+ *   ShardCount=16
+ *   DefaultIndexType=FlatTable
+ *   ExpirySweepInterval=0.1
+ *   ExpirySweepItemBudget=16384
+ *   ExpirySweepTimeBudgetMs=1.0
+ *   ExpirySweepLockBudgetMs=0.1
+ *   bExpiryWorkerThread=False
  */
-UCLASS()
+UCLASS(Config = Game)
 class HIPPOCACHE_API UHippocacheSubsystem : public UGameInstanceSubsystem
 {
 	GENERATED_BODY()
@@ -159,6 +154,8 @@ class HIPPOCACHE_API UHippocacheSubsystem : public UGameInstanceSubsystem
 public:
 	/**
 	 * @brief Gets the Hippocache Subsystem with error handling.
+	 * The result is cached per thread for the last world resolved, so repeated calls from the same world
+	 * skip the GameInstance and subsystem lookups until a subsystem is initialized or deinitialized.
 	 * @param WorldContextObject The object to get the world context from.
 	 * @param OutSubsystem The retrieved subsystem instance.
 	 * @return Result indicating success or failure.
@@ -169,6 +166,7 @@ public:
 	// USubsystem implementation
 	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
 	virtual void Deinitialize() override;
+	virtual void BeginDestroy() override;
 
 	// Client-side functions disabled for now
 	// All functionality is available through UHippocacheBlueprintLibrary instead
@@ -191,12 +189,15 @@ public:
 
 	/**
 	 * @brief Template convenience functions for direct struct access (C++ only).
+	 * Values are copied straight between T and the cache, so small plain-old-data types
+	 * (FVector, FRotator, ...) are stored and read without any heap allocation.
+	 * T is resolved through TBaseStructure, so engine structs without StaticStruct() (FVector, FGuid, ...)
+	 * can be cached directly, not just USTRUCTs declared with GENERATED_BODY.
 	 */
 	template<typename T>
 	FHippocacheResult SetStructWithTTL(FName Collection, const FString& Key, const T& Value, FTimespan TTL)
 	{
-		FInstancedStruct InstancedStruct = FInstancedStruct::Make<T>(Value);
-		return SetStructWithTTL(Collection, Key, InstancedStruct, TTL);
+		return SetStructInternal(Collection, Key, FHippocacheKey::HashString(Key), TBaseStructure<T>::Get(), &Value, TTL);
 	}
 
 	// Template specialization for FInstancedStruct to avoid recursive wrapping
@@ -212,28 +213,373 @@ public:
 		return SetStructWithTTL<T>(Collection, Key, Value, FTimespan::Zero());
 	}
 
+	/**
+	 * @brief Rvalue overloads (C++ only): Value is moved into the cache slot instead of copied, and is left
+	 * moved-from. An FInstancedStruct hands over its allocation as a whole, so the value isn't even moved.
+	 */
+	FHippocacheResult SetStructWithTTL(FName Collection, const FString& Key, FInstancedStruct&& Value, FTimespan TTL);
+	FHippocacheResult SetStruct(FName Collection, const FString& Key, FInstancedStruct&& Value);
+
+	template<typename T, typename = THippocacheMovableValue<T>>
+	FHippocacheResult SetStructWithTTL(FName Collection, const FString& Key, T&& Value, FTimespan TTL)
+	{
+		if constexpr (std::is_same_v<T, FInstancedStruct>)
+		{
+			return SetStructWithTTL(Collection, Key, MoveTemp(Value), TTL);
+		}
+		else
+		{
+			return EmplaceStructInternal(Collection, Key, FHippocacheKey::HashString(Key), TBaseStructure<T>::Get(), [&Value](void* Memory)
+			{
+				new (Memory) T(MoveTemp(Value));
+			}, TTL);
+		}
+	}
+
+	template<typename T, typename = THippocacheMovableValue<T>>
+	FHippocacheResult SetStruct(FName Collection, const FString& Key, T&& Value)
+	{
+		return SetStructWithTTL<T>(Collection, Key, MoveTemp(Value), FTimespan::Zero());
+	}
+
+	/**
+	 * @brief Constructs a T from Args directly in the memory it is cached in (C++ only), so the value
+	 * is never copied or moved. Args must not refer to values in the same collection.
+	 */
+	template<typename T, typename... ArgTypes>
+	FHippocacheResult EmplaceStructWithTTL(FName Collection, const FString& Key, FTimespan TTL, ArgTypes&&... Args)
+	{
+		return EmplaceStructInternal(Collection, Key, FHippocacheKey::HashString(Key), TBaseStructure<T>::Get(), [&Args...](void* Memory)
+		{
+			new (Memory) T(Forward<ArgTypes>(Args)...);
+		}, TTL);
+	}
+
+	template<typename T, typename... ArgTypes>
+	FHippocacheResult EmplaceStruct(FName Collection, const FString& Key, ArgTypes&&... Args)
+	{
+		return EmplaceStructWithTTL<T>(Collection, Key, FTimespan::Zero(), Forward<ArgTypes>(Args)...);
+	}
+
 	template<typename T>
 	THippocacheResult<T> GetStructTyped(FName Collection, const FString& Key)
 	{
 		static_assert(!std::is_same_v<T, FInstancedStruct>, "Cannot use FInstancedStruct with GetStructTyped");
-		FInstancedStruct OutValue;
-		auto Result = GetStruct(Collection, Key, OutValue);
-		
+		T OutValue;
+		FHippocacheResult Result = GetStructInternal(Collection, Key, FHippocacheKey::HashString(Key), TBaseStructure<T>::Get(), &OutValue);
 		if (Result.IsError())
 		{
-			return THippocacheResult<T>::Error(Result.ErrorCode, Result.ErrorMessage, Result.ErrorContext);
+			return THippocacheResult<T>(Result);
+		}
+		return THippocacheResult<T>::Success(OutValue);
+	}
+
+	/**
+	 * @brief FHippocacheKey overloads (C++ only). Same behavior as the string versions, but reuse
+	 * the key's precomputed hash instead of hashing the string on every call.
+	 */
+	FHippocacheResult SetStructWithTTL(FName Collection, const FHippocacheKey& Key, const FInstancedStruct& Value, FTimespan TTL);
+	FHippocacheResult SetStruct(FName Collection, const FHippocacheKey& Key, const FInstancedStruct& Value);
+	FHippocacheResult GetStruct(FName Collection, const FHippocacheKey& Key, FInstancedStruct& OutValue);
+	FHippocacheResult Remove(FName Collection, const FHippocacheKey& Key);
+
+	template<typename T>
+	FHippocacheResult SetStructWithTTL(FName Collection, const FHippocacheKey& Key, const T& Value, FTimespan TTL)
+	{
+		if constexpr (std::is_same_v<T, FInstancedStruct>)
+		{
+			return SetStructWithTTL(Collection, Key, static_cast<const FInstancedStruct&>(Value), TTL);
 		}
+		else
+		{
+			return SetStructInternal(Collection, Key.GetKey(), Key.GetHash(), TBaseStructure<T>::Get(), &Value, TTL);
+		}
+	}
+
+	template<typename T>
+	FHippocacheResult SetStruct(FName Collection, const FHippocacheKey& Key, const T& Value)
+	{
+		return SetStructWithTTL<T>(Collection, Key, Value, FTimespan::Zero());
+	}
 
-		if (OutValue.IsValid() && OutValue.GetScriptStruct() == T::StaticStruct())
+	FHippocacheResult SetStructWithTTL(FName Collection, const FHippocacheKey& Key, FInstancedStruct&& Value, FTimespan TTL);
+	FHippocacheResult SetStruct(FName Collection, const FHippocacheKey& Key, FInstancedStruct&& Value);
+
+	template<typename T, typename = THippocacheMovableValue<T>>
+	FHippocacheResult SetStructWithTTL(FName Collection, const FHippocacheKey& Key, T&& Value, FTimespan TTL)
+	{
+		if constexpr (std::is_same_v<T, FInstancedStruct>)
+		{
+			return SetStructWithTTL(Collection, Key, MoveTemp(Value), TTL);
+		}
+		else
 		{
-			return THippocacheResult<T>::Success(*OutValue.GetPtr<T>());
+			return EmplaceStructInternal(Collection, Key.GetKey(), Key.GetHash(), TBaseStructure<T>::Get(), [&Value](void* Memory)
+			{
+				new (Memory) T(MoveTemp(Value));
+			}, TTL);
 		}
+	}
+
+	template<typename T, typename = THippocacheMovableValue<T>>
+	FHippocacheResult SetStruct(FName Collection, const FHippocacheKey& Key, T&& Value)
+	{
+		return SetStructWithTTL<T>(Collection, Key, MoveTemp(Value), FTimespan::Zero());
+	}
+
+	template<typename T, typename... ArgTypes>
+	FHippocacheResult EmplaceStructWithTTL(FName Collection, const FHippocacheKey& Key, FTimespan TTL, ArgTypes&&... Args)
+	{
+		return EmplaceStructInternal(Collection, Key.GetKey(), Key.GetHash(), TBaseStructure<T>::Get(), [&Args...](void* Memory)
+		{
+			new (Memory) T(Forward<ArgTypes>(Args)...);
+		}, TTL);
+	}
+
+	template<typename T, typename... ArgTypes>
+	FHippocacheResult EmplaceStruct(FName Collection, const FHippocacheKey& Key, ArgTypes&&... Args)
+	{
+		return EmplaceStructWithTTL<T>(Collection, Key, FTimespan::Zero(), Forward<ArgTypes>(Args)...);
+	}
+
+	template<typename T>
+	THippocacheResult<T> GetStructTyped(FName Collection, const FHippocacheKey& Key)
+	{
+		static_assert(!std::is_same_v<T, FInstancedStruct>, "Cannot use FInstancedStruct with GetStructTyped");
+		T OutValue;
+		FHippocacheResult Result = GetStructInternal(Collection, Key.GetKey(), Key.GetHash(), TBaseStructure<T>::Get(), &OutValue);
+		if (Result.IsError())
+		{
+			return THippocacheResult<T>(Result);
+		}
+		return THippocacheResult<T>::Success(OutValue);
+	}
+
+	/**
+	 * @brief Raw-memory overloads (C++ only) for callers that only know the type at run time, such as the
+	 * Blueprint wildcard nodes. Memory points to an initialized Struct value: Set copies it straight into the
+	 * cache slot, and Get checks the cached type and copies the value straight over it, without an
+	 * intermediate FInstancedStruct either way.
+	 */
+	FHippocacheResult SetStructWithTTL(FName Collection, const FString& Key, const UScriptStruct* Struct, const void* Memory, FTimespan TTL);
+	FHippocacheResult SetStructWithTTL(FName Collection, const FHippocacheKey& Key, const UScriptStruct* Struct, const void* Memory, FTimespan TTL);
+	FHippocacheResult SetStruct(FName Collection, const FString& Key, const UScriptStruct* Struct, const void* Memory);
+	FHippocacheResult SetStruct(FName Collection, const FHippocacheKey& Key, const UScriptStruct* Struct, const void* Memory);
+	FHippocacheResult GetStruct(FName Collection, const FString& Key, const UScriptStruct* Struct, void* OutMemory);
+	FHippocacheResult GetStruct(FName Collection, const FHippocacheKey& Key, const UScriptStruct* Struct, void* OutMemory);
+
+	/**
+	 * @brief Creates a collection with explicit options instead of the defaults used by implicit creation.
+	 * Collections are otherwise created on their first Set, using ShardCount and DefaultIndexType.
+	 * @param Collection The name of the collection.
+	 * @param Options Index type and shard count for the collection.
+	 * @return Result indicating success, or InvalidCollection if the collection already exists.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Hippocache|Client")
+	FHippocacheResult CreateCollection(FName Collection, const FHippocacheCollectionOptions& Options);
+
+	/**
+	 * @brief Creates a typed collection that only holds T, stored densely (C++ only).
+	 * @param Collection The name of the collection.
+	 * @param Options Shard count for the collection. ValueType is set to T.
+	 * @return Result indicating success, or InvalidCollection if the collection already exists.
+	 */
+	template<typename T>
+	FHippocacheResult CreateTypedCollection(FName Collection, FHippocacheCollectionOptions Options = FHippocacheCollectionOptions())
+	{
+		Options.ValueType = TBaseStructure<T>::Get();
+		return CreateCollection(Collection, Options);
+	}
+
+	/**
+	 * @brief Visits every unexpired item in a collection (C++ only). Typed collections are walked
+	 * straight through their dense value arrays. Visitor must not write to the same collection.
+	 * @param Collection The name of the collection.
+	 * @param Visitor Called with each key and a view of its value.
+	 * @return Result indicating success, or ItemNotFound if the collection doesn't exist.
+	 */
+	FHippocacheResult ForEachStruct(FName Collection, TFunctionRef<void(const FString& Key, FConstStructView Value)> Visitor) const;
+	FHippocacheResult ForEachStruct(const FHippocacheCollectionHandle& Handle, TFunctionRef<void(const FString& Key, FConstStructView Value)> Visitor) const;
+
+	/** Visits every unexpired item of type T in a collection, skipping other types (C++ only). */
+	template<typename T>
+	FHippocacheResult ForEachStructTyped(FName Collection, TFunctionRef<void(const FString& Key, const T& Value)> Visitor) const
+	{
+		return ForEachStruct(Collection, [&Visitor](const FString& Key, FConstStructView Value)
+		{
+			if (Value.GetScriptStruct() == TBaseStructure<T>::Get())
+			{
+				Visitor(Key, Value.Get<T>());
+			}
+		});
+	}
+
+	/**
+	 * @brief Reads a value in place instead of copying it out (C++ only).
+	 * Visitor receives a view of the cached value itself and runs before ReadStruct returns; the view
+	 * must not be kept beyond it. A concurrent Set or Remove of the same key doesn't affect the value
+	 * being viewed: the old value stays alive until the visitor is done. Visitor must not write to the
+	 * same collection, and should be brief, since it delays reclamation of removed items.
+	 * @return Result indicating success or failure. Visitor is only called on success.
+	 */
+	FHippocacheResult ReadStruct(FName Collection, const FString& Key, TFunctionRef<void(FConstStructView Value)> Visitor);
+	FHippocacheResult ReadStruct(FName Collection, const FHippocacheKey& Key, TFunctionRef<void(FConstStructView Value)> Visitor);
+	FHippocacheResult ReadStruct(const FHippocacheCollectionHandle& Handle, const FString& Key, TFunctionRef<void(FConstStructView Value)> Visitor) const;
+	FHippocacheResult ReadStruct(const FHippocacheCollectionHandle& Handle, const FHippocacheKey& Key, TFunctionRef<void(FConstStructView Value)> Visitor) const;
+
+	/** ReadStruct for a value of type T. Fails with TypeMismatch, without calling Visitor, for any other type (C++ only). */
+	template<typename T>
+	FHippocacheResult ReadStructTyped(FName Collection, const FString& Key, TFunctionRef<void(const T& Value)> Visitor)
+	{
+		return ReadStructTypedInternal<T>(Collection, Key, FHippocacheKey::HashString(Key), Visitor);
+	}
 
-		return THippocacheResult<T>::Error(EHippocacheErrorCode::TypeMismatch, 
-			TEXT("Struct type mismatch"), 
-			FString::Printf(TEXT("Expected %s"), *T::StaticStruct()->GetName()));
+	template<typename T>
+	FHippocacheResult ReadStructTyped(FName Collection, const FHippocacheKey& Key, TFunctionRef<void(const T& Value)> Visitor)
+	{
+		return ReadStructTypedInternal<T>(Collection, Key.GetKey(), Key.GetHash(), Visitor);
 	}
 
+	/**
+	 * @brief Modifies a cached value where it is stored, instead of a GetStruct, modify, SetStruct round trip (C++ only).
+	 * Mutator runs under the key's shard write lock, so concurrent updates of one key apply one after the
+	 * other and none is lost, and readers never see a half-applied update. The item keeps its TTL. TMap and
+	 * typed collections mutate the value itself, as do FlatTable collections for small inline values; a
+	 * larger value in a FlatTable is mutated in a copy that replaces it, as its readers don't lock.
+	 * Mutator must not access the same collection, and should be brief.
+	 * @return Result indicating success or failure. Mutator is only called on success.
+	 */
+	FHippocacheResult UpdateStruct(FName Collection, const FString& Key, TFunctionRef<void(FStructView Value)> Mutator);
+	FHippocacheResult UpdateStruct(FName Collection, const FHippocacheKey& Key, TFunctionRef<void(FStructView Value)> Mutator);
+	FHippocacheResult UpdateStruct(const FHippocacheCollectionHandle& Handle, const FString& Key, TFunctionRef<void(FStructView Value)> Mutator);
+	FHippocacheResult UpdateStruct(const FHippocacheCollectionHandle& Handle, const FHippocacheKey& Key, TFunctionRef<void(FStructView Value)> Mutator);
+
+	/** UpdateStruct for a value of type T. Fails with TypeMismatch, without calling Mutator, for any other type (C++ only). */
+	template<typename T>
+	FHippocacheResult UpdateStructTyped(FName Collection, const FString& Key, TFunctionRef<void(T& Value)> Mutator)
+	{
+		return UpdateStructInternal(Collection, Key, FHippocacheKey::HashString(Key), TBaseStructure<T>::Get(), [&Mutator](FStructView Value)
+		{
+			Mutator(Value.Get<T>());
+		});
+	}
+
+	template<typename T>
+	FHippocacheResult UpdateStructTyped(FName Collection, const FHippocacheKey& Key, TFunctionRef<void(T& Value)> Mutator)
+	{
+		return UpdateStructInternal(Collection, Key.GetKey(), Key.GetHash(), TBaseStructure<T>::Get(), [&Mutator](FStructView Value)
+		{
+			Mutator(Value.Get<T>());
+		});
+	}
+
+	/**
+	 * @brief Atomic operations on cached int32, int64, float and double numbers (C++ only).
+	 * Numbers are cached as the wrapper structs of THippocacheNumericWrapper, which is how
+	 * UHippocacheBlueprintLibrary::SetInt32 and friends store them, and an operation on a value of any
+	 * other type fails with TypeMismatch. Each is one read-modify-write that no other write of the key
+	 * interleaves with, and in FlatTable collections it takes no shard lock (see FHippocacheCollection::UpdateInline).
+	 * Add, Increment and Decrement on a missing or expired key start from zero, and FetchMin and FetchMax
+	 * store Value; items they create never expire. CompareAndSwap fails with ItemNotFound instead.
+	 * Integer arithmetic wraps around on overflow, like std::atomic.
+	 *
+	 * Add adds Delta to the number stored under Key and returns the new value.
+	 */
+	template<typename T>
+	THippocacheResult<T> Add(FName Collection, const FString& Key, T Delta) { return AddInternal<T>(Collection, Key, FHippocacheKey::HashString(Key), Delta); }
+	template<typename T>
+	THippocacheResult<T> Add(FName Collection, const FHippocacheKey& Key, T Delta) { return AddInternal<T>(Collection, Key.GetKey(), Key.GetHash(), Delta); }
+	template<typename T>
+	THippocacheResult<T> Add(const FHippocacheCollectionHandle& Handle, const FString& Key, T Delta) { return AddInternal<T>(Handle, Key, FHippocacheKey::HashString(Key), Delta); }
+	template<typename T>
+	THippocacheResult<T> Add(const FHippocacheCollectionHandle& Handle, const FHippocacheKey& Key, T Delta) { return AddInternal<T>(Handle, Key.GetKey(), Key.GetHash(), Delta); }
+
+	/** Adds one to the number stored under Key. @return The new value. */
+	template<typename T>
+	THippocacheResult<T> Increment(FName Collection, const FString& Key) { return Add<T>(Collection, Key, T(1)); }
+	template<typename T>
+	THippocacheResult<T> Increment(FName Collection, const FHippocacheKey& Key) { return Add<T>(Collection, Key, T(1)); }
+	template<typename T>
+	THippocacheResult<T> Increment(const FHippocacheCollectionHandle& Handle, const FString& Key) { return Add<T>(Handle, Key, T(1)); }
+	template<typename T>
+	THippocacheResult<T> Increment(const FHippocacheCollectionHandle& Handle, const FHippocacheKey& Key) { return Add<T>(Handle, Key, T(1)); }
+
+	/** Subtracts one from the number stored under Key. @return The new value. */
+	template<typename T>
+	THippocacheResult<T> Decrement(FName Collection, const FString& Key) { return Add<T>(Collection, Key, T(-1)); }
+	template<typename T>
+	THippocacheResult<T> Decrement(FName Collection, const FHippocacheKey& Key) { return Add<T>(Collection, Key, T(-1)); }
+	template<typename T>
+	THippocacheResult<T> Decrement(const FHippocacheCollectionHandle& Handle, const FString& Key) { return Add<T>(Handle, Key, T(-1)); }
+	template<typename T>
+	THippocacheResult<T> Decrement(const FHippocacheCollectionHandle& Handle, const FHippocacheKey& Key) { return Add<T>(Handle, Key, T(-1)); }
+
+	/** Replaces the number stored under Key with Desired if it equals Expected. @return The number found, which equals Expected if it was replaced. */
+	template<typename T>
+	THippocacheResult<T> CompareAndSwap(FName Collection, const FString& Key, T Expected, T Desired) { return CompareAndSwapInternal<T>(Collection, Key, FHippocacheKey::HashString(Key), Expected, Desired); }
+	template<typename T>
+	THippocacheResult<T> CompareAndSwap(FName Collection, const FHippocacheKey& Key, T Expected, T Desired) { return CompareAndSwapInternal<T>(Collection, Key.GetKey(), Key.GetHash(), Expected, Desired); }
+	template<typename T>
+	THippocacheResult<T> CompareAndSwap(const FHippocacheCollectionHandle& Handle, const FString& Key, T Expected, T Desired) { return CompareAndSwapInternal<T>(Handle, Key, FHippocacheKey::HashString(Key), Expected, Desired); }
+	template<typename T>
+	THippocacheResult<T> CompareAndSwap(const FHippocacheCollectionHandle& Handle, const FHippocacheKey& Key, T Expected, T Desired) { return CompareAndSwapInternal<T>(Handle, Key.GetKey(), Key.GetHash(), Expected, Desired); }
+
+	/** Lowers the number stored under Key to Value if Value is smaller. @return The previous number, or Value if there was none. */
+	template<typename T>
+	THippocacheResult<T> FetchMin(FName Collection, const FString& Key, T Value) { return FetchMinMaxInternal<T>(Collection, Key, FHippocacheKey::HashString(Key), Value, false); }
+	template<typename T>
+	THippocacheResult<T> FetchMin(FName Collection, const FHippocacheKey& Key, T Value) { return FetchMinMaxInternal<T>(Collection, Key.GetKey(), Key.GetHash(), Value, false); }
+	template<typename T>
+	THippocacheResult<T> FetchMin(const FHippocacheCollectionHandle& Handle, const FString& Key, T Value) { return FetchMinMaxInternal<T>(Handle, Key, FHippocacheKey::HashString(Key), Value, false); }
+	template<typename T>
+	THippocacheResult<T> FetchMin(const FHippocacheCollectionHandle& Handle, const FHippocacheKey& Key, T Value) { return FetchMinMaxInternal<T>(Handle, Key.GetKey(), Key.GetHash(), Value, false); }
+
+	/** Raises the number stored under Key to Value if Value is larger. @return The previous number, or Value if there was none. */
+	template<typename T>
+	THippocacheResult<T> FetchMax(FName Collection, const FString& Key, T Value) { return FetchMinMaxInternal<T>(Collection, Key, FHippocacheKey::HashString(Key), Value, true); }
+	template<typename T>
+	THippocacheResult<T> FetchMax(FName Collection, const FHippocacheKey& Key, T Value) { return FetchMinMaxInternal<T>(Collection, Key.GetKey(), Key.GetHash(), Value, true); }
+	template<typename T>
+	THippocacheResult<T> FetchMax(const FHippocacheCollectionHandle& Handle, const FString& Key, T Value) { return FetchMinMaxInternal<T>(Handle, Key, FHippocacheKey::HashString(Key), Value, true); }
+	template<typename T>
+	THippocacheResult<T> FetchMax(const FHippocacheCollectionHandle& Handle, const FHippocacheKey& Key, T Value) { return FetchMinMaxInternal<T>(Handle, Key.GetKey(), Key.GetHash(), Value, true); }
+
+	/**
+	 * @brief Resolves a collection to a handle, creating it with the defaults if needed (C++ only).
+	 * @param Collection The name of the collection.
+	 * @param OutHandle Receives the handle. Reset on failure.
+	 * @return Result indicating success or failure.
+	 */
+	FHippocacheResult CreateOrGetCollection(FName Collection, FHippocacheCollectionHandle& OutHandle);
+
+	/**
+	 * @brief Removes a collection and all of its items. Handles to it become invalid.
+	 * Calls already in flight on other threads may still complete against the removed collection.
+	 * @param Collection The name of the collection.
+	 * @return Result indicating success, or ItemNotFound if the collection doesn't exist.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Hippocache|Client")
+	FHippocacheResult RemoveCollection(FName Collection);
+
+	/**
+	 * @brief Handle overloads of the data methods (C++ only). Same behavior as the name-based
+	 * versions, except an invalid handle fails with InvalidCollection.
+	 */
+	FHippocacheResult SetStructWithTTL(const FHippocacheCollectionHandle& Handle, const FString& Key, const FInstancedStruct& Value, FTimespan TTL);
+	FHippocacheResult SetStructWithTTL(const FHippocacheCollectionHandle& Handle, const FHippocacheKey& Key, const FInstancedStruct& Value, FTimespan TTL);
+	FHippocacheResult SetStruct(const FHippocacheCollectionHandle& Handle, const FString& Key, const FInstancedStruct& Value);
+	FHippocacheResult SetStruct(const FHippocacheCollectionHandle& Handle, const FHippocacheKey& Key, const FInstancedStruct& Value);
+	FHippocacheResult SetStructWithTTL(const FHippocacheCollectionHandle& Handle, const FString& Key, FInstancedStruct&& Value, FTimespan TTL);
+	FHippocacheResult SetStructWithTTL(const FHippocacheCollectionHandle& Handle, const FHippocacheKey& Key, FInstancedStruct&& Value, FTimespan TTL);
+	FHippocacheResult SetStruct(const FHippocacheCollectionHandle& Handle, const FString& Key, FInstancedStruct&& Value);
+	FHippocacheResult SetStruct(const FHippocacheCollectionHandle& Handle, const FHippocacheKey& Key, FInstancedStruct&& Value);
+	FHippocacheResult GetStruct(const FHippocacheCollectionHandle& Handle, const FString& Key, FInstancedStruct& OutValue) const;
+	FHippocacheResult GetStruct(const FHippocacheCollectionHandle& Handle, const FHippocacheKey& Key, FInstancedStruct& OutValue) const;
+	FHippocacheResult Remove(const FHippocacheCollectionHandle& Handle, const FString& Key);
+	FHippocacheResult Remove(const FHippocacheCollectionHandle& Handle, const FHippocacheKey& Key);
+	FHippocacheResult Clear(const FHippocacheCollectionHandle& Handle);
+	FHippocacheResult Num(const FHippocacheCollectionHandle& Handle, int32& OutCount) const;
+
 	/**
 	 * @brief Removes an item from the cache for a specific client.
 	 * @param Collection The name of the client.
@@ -281,18 +627,85 @@ public:
 	// UFUNCTION(BlueprintCallable, Category = "Hippocache|Memory")
 	// FHippocacheMemoryStats GetMemoryStats() const;
 
+	/** Gets the number of lock shards each collection uses (always a power of two). */
+	int32 GetShardCount() const;
+
+	/**
+	 * @brief Runs one step of the incremental expiration sweep, continuing where the previous step stopped.
+	 * Collections are swept in turn, each popping the expiry records its shards' timing wheels have due,
+	 * and no shard lock is held for longer than ExpirySweepLockBudgetMs. The sweep timer or the expiry worker calls this every ExpirySweepInterval seconds with the configured
+	 * budgets. Safe on any thread; a call made while another step is running returns at once with empty stats.
+	 * @param MaxItems Most due expiry records to examine.
+	 * @param TimeBudgetSeconds Most time to spend.
+	 * @return What the step did. Also kept for GetLastSweepStats.
+	 */
+	FHippocacheSweepStats SweepExpired(int32 MaxItems, double TimeBudgetSeconds);
+
+	/** Gets the stats of the most recent sweep step. */
+	UFUNCTION(BlueprintPure, Category = "Hippocache|Maintenance")
+	FHippocacheSweepStats GetLastSweepStats() const;
+
+protected:
+	/** Number of lock shards per collection. Rounded up to a power of two and clamped to [1, 1024]. */
+	UPROPERTY(Config)
+	int32 ShardCount = 16;
+
+	/** Index structure for collections created implicitly by Set. */
+	UPROPERTY(Config)
+	EHippocacheIndexType DefaultIndexType = EHippocacheIndexType::FlatTable;
+
+	/** Seconds between steps of the expiration sweep. */
+	UPROPERTY(Config)
+	float ExpirySweepInterval = 0.1f;
+
+	/** Most due expiry records one sweep step examines. */
+	UPROPERTY(Config)
+	int32 ExpirySweepItemBudget = 16384;
+
+	/** Most time one sweep step spends, in milliseconds. */
+	UPROPERTY(Config)
+	float ExpirySweepTimeBudgetMs = 1.0f;
+
+	/** Longest the sweep holds any one shard lock, in milliseconds. */
+	UPROPERTY(Config)
+	float ExpirySweepLockBudgetMs = 0.1f;
+
+	/**
+	 * Sweep on a dedicated background thread instead of the world's timer, keeping the work off the game thread.
+	 * Game instances without a world, as in commandlets, need this for the sweep to run at all; otherwise their
+	 * expired items are only removed when reads and writes come across them.
+	 */
+	UPROPERTY(Config)
+	bool bExpiryWorkerThread = false;
+
 private:
 	/** Map of active named Hippocache client instances. */
 	// TMap<FName, TSharedPtr<FHippocacheClient>> ActiveClients;
 
-	/** Central storage for all cached data, organized by client name. */
-	TMap<FName, TMap<FString, FCachedItem>> AllClientData;
+	/**
+	 * Current directory snapshot. Read without locking under an FHippocacheEpoch read scope;
+	 * replaced under DirectoryWriteLock, with the old snapshot retired to FHippocacheEpoch.
+	 */
+	std::atomic<FHippocacheCollectionDirectory*> Directory { nullptr };
+
+	/** Serializes collection creation. Never taken by data reads or writes. */
+	FCriticalSection DirectoryWriteLock;
 
 	/** Timer handle for periodic cleanup of expired items. */
 	FTimerHandle CleanupTimerHandle;
 
-	/** Read-write lock for thread safety - allows concurrent reads */
-	mutable FRWLock CacheRWLock;
+	/** Thread sweeping expired items instead of the timer, or nullptr. Owned; see StopExpiryWorker. */
+	FHippocacheExpiryWorker* ExpiryWorker = nullptr;
+
+	/** Collection the sweep resumes in. Collections keep their own position within themselves. */
+	FName SweepCollection;
+
+	/** Set while a sweep step runs, so steps never overlap. */
+	std::atomic<bool> bSweepRunning { false };
+
+	/** Stats of the most recent sweep step. Guarded by SweepStatsLock, since the worker writes them. */
+	FHippocacheSweepStats LastSweepStats;
+	mutable FCriticalSection SweepStatsLock;
 
 	// TODO: Memory features - disabled for now, implement later
 	//
@@ -302,15 +715,167 @@ private:
 	// Current memory statistics  
 	// mutable FHippocacheMemoryStats MemoryStats;
 
-	/** Periodically cleans up expired items from all active clients. */
+	/** Runs a sweep step with the configured budgets. Bound to the cleanup timer, or run by the expiry worker. */
 	void PerformCleanup();
 
-	/** Helper to get a client's data map, creating it if it doesn't exist. */
-	TMap<FString, FCachedItem>& GetClientData(FName Collection);
+	/** Stops the expiry worker, if any, waiting for a step in progress. */
+	void StopExpiryWorker();
+
+	/**
+	 * Finds an existing collection without locking. Returns nullptr if it doesn't exist.
+	 * The caller must hold an FHippocacheEpoch::FReadScope for as long as it uses the result.
+	 */
+	FHippocacheCollection* FindCollection(FName Collection) const;
 
+	/**
+	 * Finds a collection, creating it (and publishing a new directory snapshot) with Options if needed.
+	 * Same scope rule as FindCollection. OutCreated reports whether this call created it.
+	 */
+	const TSharedPtr<FHippocacheCollection, ESPMode::ThreadSafe>& FindOrAddCollection(FName Collection, const FHippocacheCollectionOptions& Options, bool* OutCreated = nullptr);
 
-	/** Helper to get a client's data map (const version). */
-	const TMap<FString, FCachedItem>& GetClientData(FName Collection) const;
+	/** Finds a collection, creating it with the configured defaults if needed. */
+	const TSharedPtr<FHippocacheCollection, ESPMode::ThreadSafe>& FindOrAddCollection(FName Collection);
+
+	/** Gets the collection behind Handle, or fails with InvalidCollection if it is empty or removed. */
+	static FHippocacheResult ResolveHandle(const FHippocacheCollectionHandle& Handle, FHippocacheCollection*& OutCollection);
+
+	/**
+	 * Shared bodies of the string, FHippocacheKey and typed overloads. KeyHash is FHippocacheKey::HashString(Key).
+	 * The raw-memory forms copy a Struct value directly to or from Memory. EmplaceStructInternal stores a
+	 * value that Construct builds in place (see FHippocacheCollection::Emplace).
+	 */
+	FHippocacheResult SetStructInternal(FName Collection, const FString& Key, uint64 KeyHash, const UScriptStruct* Struct, const void* Memory, FTimespan TTL);
+	FHippocacheResult SetStructInternal(FName Collection, const FString& Key, uint64 KeyHash, FInstancedStruct&& Value, FTimespan TTL);
+	FHippocacheResult EmplaceStructInternal(FName Collection, const FString& Key, uint64 KeyHash, const UScriptStruct* Struct, TFunctionRef<void(void* Memory)> Construct, FTimespan TTL);
+	FHippocacheResult GetStructInternal(FName Collection, const FString& Key, uint64 KeyHash, FInstancedStruct& OutValue);
+	FHippocacheResult GetStructInternal(FName Collection, const FString& Key, uint64 KeyHash, const UScriptStruct* Struct, void* OutMemory);
+	FHippocacheResult ReadStructInternal(FName Collection, const FString& Key, uint64 KeyHash, TFunctionRef<void(FConstStructView Value)> Visitor);
+
+	template<typename T>
+	FHippocacheResult ReadStructTypedInternal(FName Collection, const FString& Key, uint64 KeyHash, TFunctionRef<void(const T& Value)> Visitor)
+	{
+		const UScriptStruct* StoredStruct = nullptr;
+		FHippocacheResult Result = ReadStructInternal(Collection, Key, KeyHash, [&Visitor, &StoredStruct](FConstStructView Value)
+		{
+			StoredStruct = Value.GetScriptStruct();
+			if (StoredStruct == TBaseStructure<T>::Get())
+			{
+				Visitor(Value.Get<T>());
+			}
+		});
+		if (Result.IsSuccess() && StoredStruct != TBaseStructure<T>::Get())
+		{
+			return FHippocacheResult::Error(EHippocacheErrorCode::TypeMismatch, TEXT("Struct type mismatch"),
+				FString::Printf(TEXT("Collection: %s, Key: %s, Expected: %s, Stored: %s"), *Collection.ToString(), *Key, *TBaseStructure<T>::Get()->GetName(), *GetNameSafe(StoredStruct)));
+		}
+		return Result;
+	}
+	FHippocacheResult RemoveInternal(FName Collection, const FString& Key, uint64 KeyHash);
+
+	/** Shared body of UpdateStruct and UpdateStructTyped. ExpectedStruct, if set, is the only type Mutator accepts. */
+	FHippocacheResult UpdateStructInternal(FName Collection, const FString& Key, uint64 KeyHash, const UScriptStruct* ExpectedStruct, TFunctionRef<void(FStructView Value)> Mutator);
+
+	/** Validates the call and runs FHippocacheCollection::UpdateInline, creating the collection if needed. */
+	FHippocacheResult UpdateInlineInternal(FName Collection, const FString& Key, uint64 KeyHash, const UScriptStruct* Struct, TFunctionRef<bool(void* Memory, bool bFound)> Op);
+
+	/**
+	 * Shared bodies of the atomic numeric operations, for a collection name or a handle. Op gets the number
+	 * stored under Key, or zero with bFound false, and returns whether a number it built for a missing key is stored.
+	 */
+	template<typename T, typename CollectionType>
+	FHippocacheResult UpdateNumericInternal(const CollectionType& Collection, const FString& Key, uint64 KeyHash, TFunctionRef<bool(T& Value, bool bFound)> Op)
+	{
+		static_assert(THippocacheNumericWrapper<T>::bSupported, "Atomic numeric operations support int32, int64, float and double");
+		using FWrapper = typename THippocacheNumericWrapper<T>::Type;
+		return UpdateInlineInternal(Collection, Key, KeyHash, FWrapper::StaticStruct(), [&Op](void* Memory, bool bFound)
+		{
+			return Op(static_cast<FWrapper*>(Memory)->Value, bFound);
+		});
+	}
+
+	template<typename T, typename CollectionType>
+	THippocacheResult<T> AddInternal(const CollectionType& Collection, const FString& Key, uint64 KeyHash, T Delta)
+	{
+		T NewValue = T();
+		const FHippocacheResult Result = UpdateNumericInternal<T>(Collection, Key, KeyHash, [Delta, &NewValue](T& Value, bool bFound)
+		{
+			if constexpr (std::is_integral_v<T>)
+			{
+				// Unsigned arithmetic wraps instead of overflowing
+				using FUnsigned = std::make_unsigned_t<T>;
+				Value = static_cast<T>(static_cast<FUnsigned>(Value) + static_cast<FUnsigned>(Delta));
+			}
+			else
+			{
+				Value += Delta;
+			}
+			NewValue = Value;
+			return true;
+		});
+		return Result.IsSuccess() ? THippocacheResult<T>(NewValue) : THippocacheResult<T>(Result);
+	}
+
+	template<typename T, typename CollectionType>
+	THippocacheResult<T> CompareAndSwapInternal(const CollectionType& Collection, const FString& Key, uint64 KeyHash, T Expected, T Desired)
+	{
+		T FoundValue = T();
+		const FHippocacheResult Result = UpdateNumericInternal<T>(Collection, Key, KeyHash, [Expected, Desired, &FoundValue](T& Value, bool bFound)
+		{
+			if (!bFound)
+			{
+				return false;
+			}
+			FoundValue = Value;
+			if (Value == Expected)
+			{
+				Value = Desired;
+			}
+			return true;
+		});
+		return Result.IsSuccess() ? THippocacheResult<T>(FoundValue) : THippocacheResult<T>(Result);
+	}
+
+	template<typename T, typename CollectionType>
+	THippocacheResult<T> FetchMinMaxInternal(const CollectionType& Collection, const FString& Key, uint64 KeyHash, T Operand, bool bMax)
+	{
+		T PreviousValue = Operand;
+		const FHippocacheResult Result = UpdateNumericInternal<T>(Collection, Key, KeyHash, [Operand, bMax, &PreviousValue](T& Value, bool bFound)
+		{
+			if (bFound)
+			{
+				PreviousValue = Value;
+				Value = bMax ? FMath::Max(Value, Operand) : FMath::Min(Value, Operand);
+			}
+			else
+			{
+				Value = Operand;
+			}
+			return true;
+		});
+		return Result.IsSuccess() ? THippocacheResult<T>(PreviousValue) : THippocacheResult<T>(Result);
+	}
+
+	/** Shared bodies of the handle overloads. */
+	FHippocacheResult SetStructInternal(const FHippocacheCollectionHandle& Handle, const FString& Key, uint64 KeyHash, const UScriptStruct* Struct, const void* Memory, FTimespan TTL);
+	FHippocacheResult SetStructInternal(const FHippocacheCollectionHandle& Handle, const FString& Key, uint64 KeyHash, FInstancedStruct&& Value, FTimespan TTL);
+
+	/** Validates a write to Collection (or Handle's collection) and runs Write against it. bValidValue is false for a missing value. */
+	FHippocacheResult WriteInternal(FName Collection, const FString& Key, bool bValidValue, TFunctionRef<FHippocacheResult(FHippocacheCollection& Target)> Write);
+	FHippocacheResult WriteInternal(const FHippocacheCollectionHandle& Handle, const FString& Key, bool bValidValue, TFunctionRef<FHippocacheResult(FHippocacheCollection& Target)> Write);
+	FHippocacheResult GetStructInternal(const FHippocacheCollectionHandle& Handle, const FString& Key, uint64 KeyHash, FInstancedStruct& OutValue) const;
+	FHippocacheResult ReadStructInternal(const FHippocacheCollectionHandle& Handle, const FString& Key, uint64 KeyHash, TFunctionRef<void(FConstStructView Value)> Visitor) const;
+	FHippocacheResult RemoveInternal(const FHippocacheCollectionHandle& Handle, const FString& Key, uint64 KeyHash);
+	FHippocacheResult UpdateStructInternal(const FHippocacheCollectionHandle& Handle, const FString& Key, uint64 KeyHash, const UScriptStruct* ExpectedStruct, TFunctionRef<void(FStructView Value)> Mutator);
+	FHippocacheResult UpdateInlineInternal(const FHippocacheCollectionHandle& Handle, const FString& Key, uint64 KeyHash, const UScriptStruct* Struct, TFunctionRef<bool(void* Memory, bool bFound)> Op);
+
+	/** Rounds a requested shard count up to a power of two within [1, 1024]. 0 means ShardCount. */
+	int32 ResolveShardCount(int32 RequestedCount) const;
+
+	/**
+	 * @brief Unpublishes the directory and retires it.
+	 * @return The number of collections it held.
+	 */
+	int32 ReleaseDirectory();
 
 	// TODO: Memory management methods - disabled for now, implement later
 	//
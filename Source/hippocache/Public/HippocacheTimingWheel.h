@@ -0,0 +1,99 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HippocacheClock.h"
+
+struct FHippocacheEntry;
+
+/**
+ * @brief A scheduled expiration: the write of an item with a TTL, to be looked at once it is due.
+ */
+struct FHippocacheExpiryRecord
+{
+	/** The FHippocacheClock deadline the record comes due at. The item's ScheduledDeadline while it is the item's record. */
+	uint64 Deadline = FHippocacheClock::Never;
+
+	/** FHippocacheKey::HashString of the key. */
+	uint64 Hash = 0;
+
+	/** The flat table entry the write created or updated, compared by address only. Null for other layouts. */
+	const FHippocacheEntry* Entry = nullptr;
+
+	/** The key, for indexes that find an item by key. Empty for flat tables. */
+	FString Key;
+};
+
+/**
+ * @brief Hierarchical timing wheel of expiry records, so expiring items can be found without scanning the rest.
+ *
+ * Time is read from FHippocacheClock, the same clock as the records' deadlines, and advances in ticks of
+ * about TickSeconds. Level 0 has a slot per tick for the next NumSlots ticks, and each
+ * level above has a slot per NumSlots ticks of the level below, so four levels of 64 slots span about
+ * 46 hours. When the wheel enters a slot of an upper level, its records cascade down to the levels
+ * below; records due further out than the top level reaches wait in its farthest slot and are placed
+ * again when it cascades. Scheduling is O(1), every record cascades at most once per level, and ticks
+ * in which the lower levels are empty are skipped a whole slot of the lowest non-empty level at a time,
+ * so the work to find due records grows with the number of expirations rather than with the number of items.
+ *
+ * Records are never removed early. An item that is removed, or overwritten with an earlier deadline,
+ * leaves its record behind; an item overwritten with a later deadline keeps its record, which whoever
+ * pops it schedules again. Either way the popper checks the item itself. Not thread-safe; a collection
+ * shard guards its wheel with its lock.
+ */
+class HIPPOCACHE_API FHippocacheTimingWheel
+{
+public:
+	/** Length of one tick, in seconds. The wheel rounds it to a whole number of clock cycles. */
+	static constexpr double TickSeconds = 0.01;
+
+	/** Levels, and slots per level, as a power of two. */
+	static constexpr int32 NumLevels = 4;
+	static constexpr int32 SlotBits = 6;
+	static constexpr int32 NumSlots = 1 << SlotBits;
+
+	/** @param Now FHippocacheClock reading the wheel starts at. */
+	explicit FHippocacheTimingWheel(uint64 Now);
+
+	FHippocacheTimingWheel(const FHippocacheTimingWheel&) = delete;
+	FHippocacheTimingWheel& operator=(const FHippocacheTimingWheel&) = delete;
+
+	/** Schedules Record for the first tick after its Deadline. Records already due are popped next. */
+	void Schedule(FHippocacheExpiryRecord&& Record);
+
+	/**
+	 * @brief Pops one record that is due at Now, advancing the wheel as far as Now when needed.
+	 * @return False if no record is due. Every record popped has a Deadline before Now.
+	 */
+	bool PopDue(uint64 Now, FHippocacheExpiryRecord& OutRecord);
+
+	/** Gets the number of scheduled records, including stale ones. */
+	int32 Num() const { return NumRecords; }
+
+private:
+	/** Places a record in the lowest level that reaches its tick. Doesn't count it. */
+	void Insert(FHippocacheExpiryRecord&& Record);
+
+	/** Moves the records of the upper-level slots CurrentTick has just entered down the wheel. */
+	void Cascade();
+
+	/** The tick a clock reading falls in. */
+	uint64 ToTick(uint64 Time) const { return Time / TickCycles; }
+
+	/** Clock cycles per tick. */
+	const uint64 TickCycles;
+
+	/** The earliest tick whose level-0 slot may still hold records. Slot positions are relative to it. */
+	uint64 CurrentTick;
+
+	/** Scheduled records, including those in Due. */
+	int32 NumRecords = 0;
+
+	/** Records in the slots of each level, so stretches of empty levels can be skipped. */
+	int32 LevelCounts[NumLevels] = {};
+
+	/** Records of the current tick being popped, swapped out of their slot. */
+	TArray<FHippocacheExpiryRecord> Due;
+	int32 DueIndex = 0;
+
+	TArray<FHippocacheExpiryRecord> Slots[NumLevels][NumSlots];
+};
@@ -2,10 +2,18 @@
 
 #include "CoreMinimal.h"
 #include "UObject/NoExportTypes.h"
+#include "Misc/Variant.h"
 #include "HippocacheVariantWrapper.generated.h"
 
-// Forward declare FVariant to avoid UHT issues
-class FVariant;
+/**
+ * Compile-time EVariantTypes id of T, so type checks compare two integers instead of building an FVariant.
+ * Only types FVariant supports have an id; any other T fails to compile.
+ */
+template<typename T>
+struct THippocacheVariantType
+{
+    static constexpr EVariantTypes Value = TVariantTraits<T>::GetType();
+};
 
 /**
  * Wrapper struct for FVariant to make it compatible with FInstancedStruct
@@ -44,9 +52,12 @@ public:
     template<typename T>
     T GetValue() const;
 
-    // Check if the variant holds a specific type (implemented in .cpp)
+    // Check if the variant holds a specific type, without deserializing it
     template<typename T>
-    bool IsType() const;
+    bool IsType() const
+    {
+        return VariantType == static_cast<int32>(THippocacheVariantType<T>::Value);
+    }
 
     // Get the variant type (implemented in .cpp)
     int32 GetType() const;
@@ -133,4 +133,192 @@ struct HIPPOCACHE_API FDateTimeWrapper
 	{
 		return Value == Other.Value;
 	}
-};
\ No newline at end of file
+};
+
+USTRUCT()
+struct HIPPOCACHE_API FInt8Wrapper
+{
+	GENERATED_BODY()
+	
+	UPROPERTY()
+	int8 Value = 0;
+	
+	FInt8Wrapper() = default;
+	
+	explicit FInt8Wrapper(int8 InValue)
+		: Value(InValue)
+	{
+	}
+	
+	bool operator==(const FInt8Wrapper& Other) const
+	{
+		return Value == Other.Value;
+	}
+};
+
+USTRUCT()
+struct HIPPOCACHE_API FByteWrapper
+{
+	GENERATED_BODY()
+	
+	UPROPERTY()
+	uint8 Value = 0;
+	
+	FByteWrapper() = default;
+	
+	explicit FByteWrapper(uint8 InValue)
+		: Value(InValue)
+	{
+	}
+	
+	bool operator==(const FByteWrapper& Other) const
+	{
+		return Value == Other.Value;
+	}
+};
+
+USTRUCT()
+struct HIPPOCACHE_API FBoolWrapper
+{
+	GENERATED_BODY()
+	
+	UPROPERTY()
+	bool Value = false;
+	
+	FBoolWrapper() = default;
+	
+	explicit FBoolWrapper(bool InValue)
+		: Value(InValue)
+	{
+	}
+	
+	bool operator==(const FBoolWrapper& Other) const
+	{
+		return Value == Other.Value;
+	}
+};
+
+USTRUCT()
+struct HIPPOCACHE_API FNameWrapper
+{
+	GENERATED_BODY()
+	
+	UPROPERTY()
+	FName Value;
+	
+	FNameWrapper() = default;
+	
+	explicit FNameWrapper(FName InValue)
+		: Value(InValue)
+	{
+	}
+	
+	bool operator==(const FNameWrapper& Other) const
+	{
+		return Value == Other.Value;
+	}
+};
+
+USTRUCT()
+struct HIPPOCACHE_API FTimespanWrapper
+{
+	GENERATED_BODY()
+	
+	UPROPERTY()
+	FTimespan Value;
+	
+	FTimespanWrapper() = default;
+	
+	explicit FTimespanWrapper(const FTimespan& InValue)
+		: Value(InValue)
+	{
+	}
+	
+	bool operator==(const FTimespanWrapper& Other) const
+	{
+		return Value == Other.Value;
+	}
+};
+
+// These wrappers are trivially copyable, so the cache can keep them inline like FVector
+template<> struct TIsPODType<FInt8Wrapper> { enum { Value = true }; };
+template<> struct TIsPODType<FByteWrapper> { enum { Value = true }; };
+template<> struct TIsPODType<FBoolWrapper> { enum { Value = true }; };
+template<> struct TIsPODType<FInt32Wrapper> { enum { Value = true }; };
+template<> struct TIsPODType<FInt64Wrapper> { enum { Value = true }; };
+template<> struct TIsPODType<FFloatWrapper> { enum { Value = true }; };
+template<> struct TIsPODType<FDoubleWrapper> { enum { Value = true }; };
+template<> struct TIsPODType<FNameWrapper> { enum { Value = true }; };
+template<> struct TIsPODType<FDateTimeWrapper> { enum { Value = true }; };
+template<> struct TIsPODType<FTimespanWrapper> { enum { Value = true }; };
+
+/**
+ * Maps the primitive types UHippocacheBlueprintLibrary's typed setters accept to the wrapper struct they
+ * are cached as. Types that are structs themselves (FVector, FGuid, ...) are cached as-is and have no
+ * wrapper, so bSupported is false for them.
+ */
+template<typename T>
+struct THippocachePrimitiveWrapper
+{
+	static constexpr bool bSupported = false;
+};
+
+#define HIPPOCACHE_PRIMITIVE_WRAPPER(ValueType, WrapperType) \
+	template<> \
+	struct THippocachePrimitiveWrapper<ValueType> \
+	{ \
+		static constexpr bool bSupported = true; \
+		using Type = WrapperType; \
+	};
+
+HIPPOCACHE_PRIMITIVE_WRAPPER(int8, FInt8Wrapper)
+HIPPOCACHE_PRIMITIVE_WRAPPER(uint8, FByteWrapper)
+HIPPOCACHE_PRIMITIVE_WRAPPER(bool, FBoolWrapper)
+HIPPOCACHE_PRIMITIVE_WRAPPER(int32, FInt32Wrapper)
+HIPPOCACHE_PRIMITIVE_WRAPPER(int64, FInt64Wrapper)
+HIPPOCACHE_PRIMITIVE_WRAPPER(float, FFloatWrapper)
+HIPPOCACHE_PRIMITIVE_WRAPPER(double, FDoubleWrapper)
+HIPPOCACHE_PRIMITIVE_WRAPPER(FString, FStringWrapper)
+HIPPOCACHE_PRIMITIVE_WRAPPER(FName, FNameWrapper)
+HIPPOCACHE_PRIMITIVE_WRAPPER(FDateTime, FDateTimeWrapper)
+HIPPOCACHE_PRIMITIVE_WRAPPER(FTimespan, FTimespanWrapper)
+
+#undef HIPPOCACHE_PRIMITIVE_WRAPPER
+
+/**
+ * Maps the numeric types that UHippocacheSubsystem's atomic operations support to the wrapper struct
+ * they are cached as. bSupported is false for every other type.
+ */
+template<typename T>
+struct THippocacheNumericWrapper
+{
+	static constexpr bool bSupported = false;
+};
+
+template<>
+struct THippocacheNumericWrapper<int32>
+{
+	static constexpr bool bSupported = true;
+	using Type = FInt32Wrapper;
+};
+
+template<>
+struct THippocacheNumericWrapper<int64>
+{
+	static constexpr bool bSupported = true;
+	using Type = FInt64Wrapper;
+};
+
+template<>
+struct THippocacheNumericWrapper<float>
+{
+	static constexpr bool bSupported = true;
+	using Type = FFloatWrapper;
+};
+
+template<>
+struct THippocacheNumericWrapper<double>
+{
+	static constexpr bool bSupported = true;
+	using Type = FDoubleWrapper;
+};